@@ -0,0 +1,64 @@
+// Throughput of the fixed point instantiations against collider_f: one frame
+// rotates every collider (transform cost) and tests every pair (SAT cost).
+
+#include <tiny_colls.h>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace tiny_colls;
+
+const int COLLIDERS = 400;
+const int FRAMES = 20;
+
+struct lcg {
+    uint32_t state = 12345;
+    float next(float lo, float hi) {
+        state = state * 1664525u + 1013904223u;
+        return lo + (hi - lo) * float(state >> 8) / float(1 << 24);
+    }
+};
+
+template <typename T>
+void run(const std::string& name) {
+    lcg rng;
+    std::vector<collider<T>> colliders;
+    for (int i = 0; i < COLLIDERS; i++) {
+        auto c = (i % 2) 
+            ? collider<T>::rect(T(rng.next(2, 10)), T(rng.next(2, 10))) 
+            : collider<T>::circle(T(rng.next(1, 5)));
+        colliders.push_back(c.set_position(T(rng.next(-100, 100)), T(rng.next(-100, 100))));
+    }
+
+    int hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        for (int i = 0; i < COLLIDERS; i++) {
+            colliders[i].set_rotation(T(float(frame) * 0.05f + float(i)));
+        }
+
+        for (int i = 0; i < COLLIDERS; i++) {
+            for (int j = i + 1; j < COLLIDERS; j++) {
+                collision<T> c;
+                hits += colliders[i].is_colliding_with(colliders[j], c);
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double pairs = double(FRAMES) * COLLIDERS * (COLLIDERS - 1) / 2;
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << name << ": " << ns / pairs << " ns/pair, " << hits << " hits" << std::endl;
+}
+
+int main() {
+    run<float>("collider_f");
+    run<double>("collider_d");
+    run<q16_16>("collider<q16_16>");
+#ifdef __SIZEOF_INT128__
+    run<q32_32>("collider<q32_32>");
+#endif
+    return EXIT_SUCCESS;
+}
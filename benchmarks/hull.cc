@@ -0,0 +1,88 @@
+// Hull construction time across point counts, for a filled disc (most points
+// interior) and a noisy outline (most points near the hull, like a sprite
+// alpha contour).
+
+#include <tiny_colls.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace tiny_colls;
+
+struct lcg {
+    uint32_t state = 12345;
+    float next() {
+        state = state * 1664525u + 1013904223u;
+        return float(state >> 8) / float(1 << 24);
+    }
+};
+
+std::vector<point_f> disc(size_t n) {
+    lcg rng;
+    std::vector<point_f> points;
+    for (size_t i = 0; i < n; i++) {
+        float a = rng.next() * 6.2831853f;
+        float r = 500.0f * std::sqrt(rng.next());
+        points.push_back({ r * std::cos(a), r * std::sin(a) });
+    }
+    return points;
+}
+
+std::vector<point_f> outline(size_t n) {
+    lcg rng;
+    std::vector<point_f> points;
+    for (size_t i = 0; i < n; i++) {
+        float a = 6.2831853f * float(i) / float(n);
+        float r = 500.0f + 4.0f * rng.next();
+        points.push_back({ r * std::cos(a), r * std::sin(a) });
+    }
+    return points;
+}
+
+double time_ms(const std::vector<point_f>& points, const hull_options_f& options, size_t& vertices) {
+    const int RUNS = 5;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < RUNS; i++) {
+        vertices = convex_hull(points, options).size();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / RUNS;
+}
+
+void run(const std::string& name, const std::vector<point_f>& points) {
+    hull_options_f plain;
+    plain.prefilter = false;
+
+    hull_options_f filtered;
+
+    hull_options_f parallel;
+    parallel.parallel = true;
+
+    hull_options_f simplified;
+    simplified.parallel = true;
+    simplified.max_vertices = 32;
+
+    size_t v0, v1, v2, v3;
+    double t0 = time_ms(points, plain, v0);
+    double t1 = time_ms(points, filtered, v1);
+    double t2 = time_ms(points, parallel, v2);
+    double t3 = time_ms(points, simplified, v3);
+
+    std::cout << name << " n=" << points.size()
+        << "  monotone chain: " << t0 << " ms"
+        << "  + prefilter: " << t1 << " ms"
+        << "  + parallel sort: " << t2 << " ms"
+        << "  + simplify to 32: " << t3 << " ms"
+        << "  (" << v0 << " -> " << v3 << " vertices)" << std::endl;
+}
+
+int main() {
+    for (size_t n : { 1000, 10000, 100000, 1000000 }) {
+        run("disc   ", disc(n));
+        run("outline", outline(n));
+    }
+    return EXIT_SUCCESS;
+}
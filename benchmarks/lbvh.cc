@@ -0,0 +1,71 @@
+// Full LBVH rebuild and pair traversal over a swarm of small circles, on one
+// thread and on every core.
+
+#include <tiny_colls.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace tiny_colls;
+
+struct lcg {
+    uint32_t state = 12345;
+    float next() {
+        state = state * 1664525u + 1013904223u;
+        return float(state >> 8) / float(1 << 24);
+    }
+};
+
+std::vector<AABB_f> swarm(size_t n) {
+    lcg rng;
+    float side = std::sqrt(float(n)) * 4.0f;
+
+    std::vector<AABB_f> boxes;
+    for (size_t i = 0; i < n; i++) {
+        auto c = collider_f::circle<8>(1.0f).set_position(rng.next() * side, rng.next() * side);
+        boxes.push_back(c.get_bounding_box());
+    }
+    return boxes;
+}
+
+template <typename F>
+double time_ms(F&& f) {
+    const int RUNS = 10;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < RUNS; i++) f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / RUNS;
+}
+
+int main() {
+    unsigned cores = std::thread::hardware_concurrency();
+
+    for (size_t n : { 10000, 100000, 1000000 }) {
+        auto boxes = swarm(n);
+        lbvh_f tree;
+
+        double build_1 = time_ms([&] { tree.build(boxes, 1); });
+        double build_n = time_ms([&] { tree.build(boxes, 0); });
+
+        size_t pairs_1 = 0;
+        double pairs_time_1 = time_ms([&] {
+            pairs_1 = 0;
+            tree.for_each_overlap([&](uint32_t, uint32_t) { pairs_1++; });
+        });
+
+        std::atomic<size_t> pairs_n = 0;
+        double pairs_time_n = time_ms([&] {
+            pairs_n = 0;
+            tree.for_each_overlap_parallel([&](uint32_t, uint32_t, unsigned) { pairs_n.fetch_add(1, std::memory_order_relaxed); });
+        });
+
+        std::cout << "n=" << n
+            << "  build: " << build_1 << " ms, " << build_n << " ms on " << cores << " threads"
+            << "  pairs: " << pairs_time_1 << " ms, " << pairs_time_n << " ms on " << cores << " threads"
+            << "  (" << pairs_1 << " / " << pairs_n << " pairs)" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
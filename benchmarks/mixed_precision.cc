@@ -0,0 +1,95 @@
+// Mixed precision SAT against plain collider_d, for scenes near the origin
+// and far from it: time per pair, disagreeing hits and the largest MTV
+// overlap difference.
+
+#include <tiny_colls.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace tiny_colls;
+
+const int COLLIDERS = 400;
+const int FRAMES = 20;
+
+struct lcg {
+    uint32_t state = 12345;
+    double next(double lo, double hi) {
+        state = state * 1664525u + 1013904223u;
+        return lo + (hi - lo) * double(state >> 8) / double(1 << 24);
+    }
+};
+
+std::vector<collider_d> scene(double offset) {
+    lcg rng;
+    std::vector<collider_d> colliders;
+    for (int i = 0; i < COLLIDERS; i++) {
+        auto c = (i % 2) ? collider_d::rect(rng.next(2, 10), rng.next(2, 10)) : collider_d::circle(rng.next(1, 5));
+        colliders.push_back(c.set_position(offset + rng.next(-100, 100), offset + rng.next(-100, 100)));
+    }
+    return colliders;
+}
+
+template <typename F>
+double ns_per_pair(std::vector<collider_d>& colliders, F&& test) {
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        for (int i = 0; i < COLLIDERS; i++) colliders[i].set_rotation(frame * 0.05 + i);
+        for (int i = 0; i < COLLIDERS; i++) {
+            for (int j = i + 1; j < COLLIDERS; j++) test(colliders[i], colliders[j]);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double pairs = double(FRAMES) * COLLIDERS * (COLLIDERS - 1) / 2;
+    return std::chrono::duration<double, std::nano>(end - start).count() / pairs;
+}
+
+void run(double offset) {
+    auto colliders = scene(offset);
+
+    size_t hits = 0;
+    double exact = ns_per_pair(colliders, [&](collider_d& a, collider_d& b) {
+        collision_d c;
+        hits += a.is_colliding_with(b, c);
+    });
+    // is_colliding_with_mixed rejects on bounding boxes first, time double
+    // with the same check for a fair comparison.
+    double boxed = ns_per_pair(colliders, [&](collider_d& a, collider_d& b) {
+        AABB_d x = a.get_bounding_box();
+        AABB_d y = b.get_bounding_box();
+        if (x.right < y.left || y.right < x.left || x.top < y.bottom || y.top < x.bottom) return;
+        collision_d c;
+        hits += a.is_colliding_with(b, c);
+    });
+    double mixed = ns_per_pair(colliders, [&](collider_d& a, collider_d& b) {
+        collision_d c;
+        hits += a.is_colliding_with_mixed(b, c);
+    });
+
+    size_t disagreements = 0;
+    double worst = 0;
+    for (int i = 0; i < COLLIDERS; i++) {
+        for (int j = i + 1; j < COLLIDERS; j++) {
+            collision_d e, m;
+            bool he = colliders[i].is_colliding_with(colliders[j], e);
+            bool hm = colliders[i].is_colliding_with_mixed(colliders[j], m);
+            if (he != hm) disagreements++;
+            else if (he) worst = std::max(worst, std::abs(std::abs(e.overlap) - std::abs(m.overlap)));
+        }
+    }
+
+    std::cout << "offset " << offset << ": collider_d " << exact << " ns/pair, with box reject " << boxed
+        << " ns/pair, mixed " << mixed << " ns/pair, "
+        << disagreements << " disagreeing pairs, max overlap error " << worst << " (" << hits / 3 << " hits)" << std::endl;
+}
+
+int main() {
+    run(0);
+    run(1e4);
+    run(1e7);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+// Replays a trace recorded with trace_recorder_d and prints frame time
+// percentiles:
+//   bench_replay trace.bin [--lbvh] [--cell N] [--pair-cache] [--mixed] [--workers N]
+// Without a trace, records a synthetic one and replays it in every
+// configuration.
+
+#include <tiny_colls.h>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace tiny_colls;
+
+const int COLLIDERS = 2000;
+const int FRAMES = 120;
+
+struct lcg {
+    uint32_t state = 12345;
+    double next(double lo, double hi) {
+        state = state * 1664525u + 1013904223u;
+        return lo + (hi - lo) * double(state >> 8) / double(1 << 24);
+    }
+};
+
+std::string synthetic_trace() {
+    std::stringstream out;
+    world_d w;
+    trace_recorder_d rec(w, out);
+    lcg rng;
+
+    std::vector<collider_handle> handles;
+    for (int i = 0; i < COLLIDERS; i++) {
+        // Odd vertex counts too, traces have to round trip them.
+        collider_d c;
+        switch (i % 4) {
+        case 0: c = collider_d::rect(rng.next(4, 16), rng.next(4, 16)); break;
+        case 1: c = collider_d::circle(rng.next(2, 8)); break;
+        case 2: c = collider_d::poly<7>(rng.next(4, 16), rng.next(4, 16)); break;
+        default: c = collider_d::from_points({ { 0, 0 }, { rng.next(4, 16), 0 }, { rng.next(0, 8), rng.next(4, 16) } }); break;
+        }
+        handles.push_back(rec.add(c.set_position(rng.next(0, 2000), rng.next(0, 2000))));
+    }
+
+    for (int frame = 0; frame < FRAMES; frame++) {
+        // A tenth of the colliders move each frame.
+        for (int i = frame % 10; i < COLLIDERS; i += 10) {
+            rec.set_position(handles[i], rng.next(0, 2000), rng.next(0, 2000));
+            rec.set_rotation(handles[i], rng.next(0, 6.28));
+        }
+        rec.update();
+        rec.for_each_contact([](const contact_d&) {});
+        rec.query_circle(rng.next(0, 2000), rng.next(0, 2000), 100, [](collider_handle, const collision_d&) {});
+        rec.end_frame();
+    }
+    return out.str();
+}
+
+void report(const std::string& name, const replay_result& r) {
+    std::cout << name << ": " << r.frame_ms.size() << " frames, " << r.contacts << " contacts, "
+              << r.query_hits << " query hits, p50 " << r.percentile(50) << " ms, p90 " << r.percentile(90)
+              << " ms, p99 " << r.percentile(99) << " ms, max " << r.percentile(100) << " ms\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::string trace = synthetic_trace();
+        auto run = [&](const std::string& name, replay_options_d options) {
+            std::istringstream in(trace);
+            report(name, replay_trace(in, options));
+        };
+
+        run("grid", {});
+        run("grid + pair cache", { .pair_cache = true });
+        run("grid + mixed", { .mixed_precision = true });
+        run("lbvh", { .broadphase = replay_broadphase::lbvh });
+        run("lbvh + mixed", { .broadphase = replay_broadphase::lbvh, .mixed_precision = true });
+        return 0;
+    }
+
+    replay_options_d options;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--lbvh") options.broadphase = replay_broadphase::lbvh;
+        else if (arg == "--pair-cache") options.pair_cache = true;
+        else if (arg == "--mixed") options.mixed_precision = true;
+        else if (arg == "--cell" && i + 1 < argc) options.cell_size = std::atof(argv[++i]);
+        else if (arg == "--workers" && i + 1 < argc) options.workers = unsigned(std::atoi(argv[++i]));
+        else {
+            std::cerr << "unknown argument " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in) {
+        std::cerr << "cannot open " << argv[1] << "\n";
+        return 1;
+    }
+    report(argv[1], replay_trace(in, options));
+    return 0;
+}
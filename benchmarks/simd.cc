@@ -0,0 +1,69 @@
+// Float and double kernels at every SIMD level this CPU supports: projection
+// through SAT on round shapes, batch transforms and batch point tests.
+
+#include <tiny_colls.h>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace tiny_colls;
+
+const int ROUNDS = 200;
+const char* LEVEL_NAMES[] = { "scalar", "sse2", "avx2", "avx512" };
+
+template <typename F>
+double ns_per(size_t count, F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) f(round);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double(ROUNDS) * count);
+}
+
+template <typename T>
+void run(const char* type) {
+    std::vector<collider<T>> shapes;
+    for (int i = 0; i < 256; i++) {
+        shapes.push_back(collider<T>::template circle<64>(T(4)).set_position(T(i % 16) * T(6), T(i / 16) * T(6)));
+    }
+
+    std::vector<point<T>> points;
+    for (int i = 0; i < 4096; i++) points.push_back({ T(i % 64) * T(0.2) - T(6.4), T(i / 64) * T(0.2) - T(6.4) });
+    std::unique_ptr<bool[]> inside(new bool[points.size()]);
+
+    for (int level = 0; level <= int(get_max_simd_level()); level++) {
+        set_simd_level(simd_level(level));
+
+        double transform = ns_per(shapes.size(), [&](int round) {
+            for (auto& s : shapes) {
+                s.set_rotation(T(round) * T(0.01));
+                s.get_bounding_box();
+            }
+        });
+
+        size_t hits = 0;
+        double pair = ns_per(shapes.size() - 1, [&](int) {
+            for (size_t i = 0; i + 1 < shapes.size(); i++) {
+                collision<T> c;
+                hits += shapes[i].is_colliding_with(shapes[i + 1], c);
+            }
+        });
+
+        size_t in = 0;
+        double point_test = ns_per(points.size(), [&](int) {
+            in += shapes[0].set_position(T(0), T(0)).is_point_in(points, std::span<bool>(inside.get(), points.size()));
+        });
+
+        std::cout << type << " " << LEVEL_NAMES[level] << ": transform " << transform << " ns/collider, sat "
+                  << pair << " ns/pair (" << hits << " hits), points " << point_test << " ns/point (" << in << " in)\n";
+    }
+}
+
+int main() {
+    simd_level startup = get_simd_level();
+    run<float>("float");
+    run<double>("double");
+    set_simd_level(startup);
+    return 0;
+}
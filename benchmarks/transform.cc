@@ -0,0 +1,63 @@
+// Per frame transform cost for many moving bodies: every collider is moved
+// and rotated, then brought up to date one by one or in a batch.
+
+#include <tiny_colls.h>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace tiny_colls;
+
+std::vector<collider_f> bodies(size_t n) {
+    std::vector<collider_f> out;
+    out.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        out.push_back(i % 2 ? collider_f::rect(4.0f, 2.0f) : collider_f::circle<16>(1.5f));
+    }
+    return out;
+}
+
+void move(std::vector<collider_f>& colliders, int frame) {
+    for (size_t i = 0; i < colliders.size(); i++) {
+        colliders[i].set_position(float(i % 1000) + frame * 0.1f, float(i / 1000));
+        colliders[i].set_rotation(0.01f * float(frame + i));
+    }
+}
+
+template <typename F>
+double time_ms(std::vector<collider_f>& colliders, F&& update) {
+    const int FRAMES = 20;
+    double total = 0;
+    for (int frame = 0; frame < FRAMES; frame++) {
+        move(colliders, frame);
+        auto start = std::chrono::steady_clock::now();
+        update(colliders);
+        auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    return total / FRAMES;
+}
+
+int main() {
+    for (size_t n : { 1000, 10000, 100000 }) {
+        auto colliders = bodies(n);
+
+        double single = time_ms(colliders, [](std::vector<collider_f>& c) {
+            for (auto& x : c) x.get_bounding_box();
+        });
+        double batch = time_ms(colliders, [](std::vector<collider_f>& c) {
+            collider_f::update_transforms(c);
+        });
+        double threaded = time_ms(colliders, [](std::vector<collider_f>& c) {
+            collider_f::update_transforms(c, 0);
+        });
+
+        std::cout << "n=" << n
+            << "  one by one: " << single << " ms"
+            << "  batch: " << batch << " ms"
+            << "  batch on " << std::thread::hardware_concurrency() << " threads: " << threaded << " ms" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
@@ -1,6 +1,19 @@
 #pragma once
 
 #include "tiny_colls/collider.h"
+#include "tiny_colls/static_collider.h"
+#include "tiny_colls/compound.h"
 #include "tiny_colls/collision.h"
 #include "tiny_colls/aabb.h"
-#include "tiny_colls/point.h"
\ No newline at end of file
+#include "tiny_colls/affine.h"
+#include "tiny_colls/shape_view.h"
+#include "tiny_colls/point.h"
+#include "tiny_colls/fixed.h"
+#include "tiny_colls/world.h"
+#include "tiny_colls/contact_tracker.h"
+#include "tiny_colls/stats.h"
+#include "tiny_colls/streaming.h"
+#include "tiny_colls/lbvh.h"
+#include "tiny_colls/solver.h"
+#include "tiny_colls/trace.h"
+#include "tiny_colls/simd.h"
\ No newline at end of file
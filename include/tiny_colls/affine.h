@@ -0,0 +1,17 @@
+#pragma once
+
+namespace tiny_colls {
+// 2D affine transform: x' = m00 * x + m01 * y + tx, y' = m10 * x + m11 * y + ty
+template <typename T>
+struct affine {
+    T m00 = T(1);
+    T m01 = T(0);
+    T m10 = T(0);
+    T m11 = T(1);
+    T tx = T(0);
+    T ty = T(0);
+};
+
+using affine_f = affine<float>;
+using affine_d = affine<double>;
+}
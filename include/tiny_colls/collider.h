@@ -1,19 +1,28 @@
 #pragma once
 
 #include <vector>
+#include <span>
 #include <numbers>
 #include <cmath>
 #include <cassert>
 #include <array>
 #include <memory>
+#include <atomic>
+#include <type_traits>
 #include "tiny_colls/collision.h"
 #include "tiny_colls/point.h"
 #include "tiny_colls/aabb.h"
+#include "tiny_colls/affine.h"
+#include "tiny_colls/shape_view.h"
+#include "tiny_colls/hull.h"
+#include "tiny_colls/details/scalar.h"
 
 namespace tiny_colls {
+namespace details { struct collider_access; }
+
 template<typename T>
 class collider {
-    static_assert(std::is_floating_point<T>::value, "collider<T>: T must be floating point");
+    static_assert(details::scalar<T>, "collider<T>: T must be floating or fixed point");
 public:
     collider(const collider& c);
     collider() noexcept = default;
@@ -23,7 +32,16 @@ public:
 
     collider& set_position(T x, T y);
     collider& set_rotation(T rotation);
+    // Scales the shape before rotating it, keeping position and rotation.
+    collider& set_scale(T scale);
+    collider& set_scale(T sx, T sy);
+    // Replaces position, rotation and scale with m, which may also shear.
+    // A later set_rotation rotates on top of m.
+    collider& set_transform(const affine<T>& m);
+    static void set_transforms(std::span<collider> colliders, std::span<const affine<T>> transforms);
 
+    point<T> get_position() const;
+    T get_rotation() const;
     std::vector<point<T>> get_shape() const;
     AABB<T> get_bounding_box() const;
     // RAW FORMAT
@@ -33,19 +51,63 @@ public:
     // i = 3..n: vertices (i: x, i + 1: y)
     std::vector<T> get_raw() const;
 
+    // Views over the cached transformed vertices and unit edge normals. They
+    // transform the collider if needed but never copy, and stay valid while
+    // the collider lives; moving it shows in them after the next transform.
+    shape_view<T> get_shape_view() const;
+    shape_view<T> get_axes_view() const;
+    // Write the first out.size() values of get_shape() or get_raw() into out
+    // and return the full count, so a buffer can be sized and reused.
+    size_t get_shape(std::span<point<T>> out) const;
+    size_t get_raw(std::span<T> out) const;
+
     bool is_point_in(T x, T y);
+    // out[i] tells whether points[i] is in the collider, out must be as long
+    // as points. Returns how many are.
+    size_t is_point_in(std::span<const point<T>> points, std::span<bool> out);
     bool is_colliding_with(const collider& other, collision<T>& out);
 
+    // Precomputes coarser polygons enclosing the shape, one per vertex count.
+    // Counts not below the shape's own vertex count are ignored.
+    collider& set_lod_levels(const std::vector<int>& vertex_counts);
+    size_t get_lod_count() const;
+    // Same result as is_colliding_with, but rejects pairs on the coarsest
+    // levels first and only runs the full shapes when every level overlaps.
+    bool is_colliding_with_lod(const collider& other, collision<T>& out);
+    // Same result as is_colliding_with, but runs SAT in float around the
+    // pair's midpoint and only redoes it in double when an axis is decided by
+    // a hair. Meant for collider_d in worlds far from the origin.
+    bool is_colliding_with_mixed(const collider& other, collision<T>& out) requires std::is_floating_point_v<T>;
+
+    // Brings every moved collider up to date, split over `workers` threads
+    // (0 for one per core). Each collider computes sin and cos once and
+    // rotates its vertices, axes and bounding box in a single pass.
+    static void update_transforms(std::span<collider> colliders, unsigned workers = 1);
+
+    // Default for the factories below that take no vertex count.
     static void set_ellipse_vertex_count(int count);
 
     static collider rect(T width, T height);
     static collider poly(T width, T height, int N);
     static collider ellipse(T a, T b);
+    static collider ellipse(T a, T b, int vertex_count);
     static collider circle(T radius);
+    static collider circle(T radius, int vertex_count);
     static collider capsule(T width, T height);
+    static collider capsule(T width, T height, int vertex_count);
     static collider line(T length);
     static collider rounded_rect(T width, T height, T roundness);
+    static collider rounded_rect(T width, T height, T roundness, int vertex_count);
+
+    // Unit shapes for N vertices are tessellated at compile time, building
+    // one only scales and copies them.
+    template<int N> static collider poly(T width, T height);
+    template<int N> static collider ellipse(T a, T b);
+    template<int N> static collider circle(T radius);
+    template<int N> static collider capsule(T width, T height);
+    template<int N> static collider rounded_rect(T width, T height, T roundness);
     static collider from_points(const std::vector<point<T>>& points);
+    static collider from_points(const std::vector<point<T>>& points, const hull_options<T>& options);
     // RAW FORMAT
     // i = 0:   position x
     // i = 1:   position y
@@ -53,7 +115,9 @@ public:
     // i = 3..n: vertices (i: x, i + 1: y)
     static collider raw(const std::vector<T>& data);
 private:    
-    static int ellipse_vertex_count;
+    friend struct details::collider_access;
+    static std::atomic<int> ellipse_vertex_count;
+    static void check_vertex_count(int count);
     
     struct Impl;
     collider(std::unique_ptr<Impl> impl);
@@ -65,4 +129,5 @@ using collider_d = collider<double>;
 
 }
 
-#include "tiny_colls/details/collider_impl.h"
\ No newline at end of file
+#include "tiny_colls/details/collider_impl.h"
+#include "tiny_colls/details/collider_access.h"
\ No newline at end of file
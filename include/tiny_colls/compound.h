@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "tiny_colls/collider.h"
+#include "tiny_colls/collision.h"
+#include "tiny_colls/point.h"
+#include "tiny_colls/aabb.h"
+
+namespace tiny_colls {
+// Concave shape made of convex parts sharing one transform. A small bounding
+// volume hierarchy over the parts limits SAT to parts whose boxes overlap.
+template<typename T>
+class compound {
+public:
+    compound() = default;
+    // Convex parts in the local space of the compound.
+    explicit compound(const std::vector<std::vector<point<T>>>& parts);
+
+    compound& set_position(T x, T y);
+    compound& set_rotation(T rotation);
+
+    AABB<T> get_bounding_box() const;
+    const std::vector<collider<T>>& get_parts() const;
+
+    bool is_point_in(T x, T y);
+    // `out` is the MTV of the deepest overlapping part pair.
+    bool is_colliding_with(const compound& other, collision<T>& out);
+    bool is_colliding_with(const collider<T>& other, collision<T>& out);
+
+    // f(size_t part, size_t other_part, const collision<T>& c) for every
+    // overlapping pair of parts.
+    template<typename F>
+    void for_each_part_contact(const compound& other, F&& f);
+
+    // Splits a simple polygon into convex parts.
+    static compound from_polygon(const std::vector<point<T>>& polygon);
+private:
+    struct node {
+        AABB<T> box {};
+        int32_t left = -1;
+        int32_t right = -1;
+        int32_t part = -1;
+    };
+
+    // Median splits keep the tree balanced, so with int32_t part indices it is
+    // never deeper than this and traversals use fixed stacks.
+    static constexpr size_t max_depth = 33;
+
+    int32_t build(std::vector<uint32_t>& order, size_t begin, size_t end);
+    void ensure_transformed() const;
+
+    mutable std::vector<collider<T>> parts;
+    mutable std::vector<node> nodes;
+    T x = T(0);
+    T y = T(0);
+    T rotation = T(0);
+    mutable bool dirty = true;
+};
+
+// Splits a simple polygon (either winding, no self intersections) into convex
+// pieces: ear clipping triangulation followed by Hertel-Mehlhorn merging, so
+// the result has at most four times the optimal number of pieces.
+template<typename T>
+std::vector<std::vector<point<T>>> decompose(const std::vector<point<T>>& polygon);
+
+using compound_f = compound<float>;
+using compound_d = compound<double>;
+}
+
+#include "tiny_colls/details/compound_impl.h"
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "tiny_colls/world.h"
+
+namespace tiny_colls {
+// Keeps the set of touching pairs of a world between frames and reports
+// which pairs began, persisted and ended touching in the last update.
+// Pairs are kept sorted, so steady state updates do not hash or allocate.
+template<typename T>
+class contact_tracker {
+public:
+    // Data retained per touching pair, e.g. for warm starting a solver.
+    struct pair_data {
+        contact<T> last;
+        uint32_t frames = 0;
+    };
+
+    // Runs the world pair pass and diffs it against the previous update.
+    void update(world<T>& w);
+
+    // Events of the last update, ended pairs carry their last contact.
+    const std::vector<contact<T>>& began() const;
+    const std::vector<contact<T>>& persisted() const;
+    const std::vector<contact<T>>& ended() const;
+
+    const pair_data* find(collider_handle a, collider_handle b) const;
+    size_t size() const;
+    void clear();
+private:
+    struct entry {
+        uint64_t key;
+        pair_data data;
+    };
+
+    static uint64_t key_of(collider_handle a, collider_handle b);
+
+    std::vector<entry> current;
+    std::vector<entry> next;
+    std::vector<contact<T>> began_events;
+    std::vector<contact<T>> persisted_events;
+    std::vector<contact<T>> ended_events;
+};
+
+using contact_tracker_f = contact_tracker<float>;
+using contact_tracker_d = contact_tracker<double>;
+}
+
+#include "tiny_colls/details/contact_tracker_impl.h"
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace tiny_colls::details {
+// Lets the other shape and world types in the library reach collider internals
+// without widening the public collider interface.
+struct collider_access {
+    template <typename T>
+    static typename collider<T>::Impl& impl(const collider<T>& c) {
+        if (!c.impl) {
+            throw std::logic_error("Cannot access non-initialized collider.");
+        }
+        return *c.impl;
+    }
+
+    template <typename T>
+    static typename collider<T>::Impl& transformed(const collider<T>& c) {
+        auto& i = impl(c);
+        i.ensure_transformed();
+        return i;
+    }
+};
+}
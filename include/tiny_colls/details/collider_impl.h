@@ -8,7 +8,14 @@
 #include <array>
 #include "tiny_colls/details/vec.h"
 #include "tiny_colls/details/proj.h"
+#include "tiny_colls/details/sat.h"
+#include "tiny_colls/details/mixed.h"
+#include "tiny_colls/details/tessellation.h"
+#include "tiny_colls/details/lod.h"
+#include "tiny_colls/details/transform.h"
+#include "tiny_colls/details/parallel.h"
 #include "tiny_colls/collision.h"
+#include "tiny_colls/stats.h"
 
 namespace tiny_colls {
 using details::vec;
@@ -17,7 +24,15 @@ using details::proj;
 template<typename T>
 struct collider<T>::Impl {
     Impl(std::vector<vec<T>> vertices)    
-        : vertices(vertices), position(0, 0), rotation(0.0f) { 
+        : vertices(vertices), axes(calculate_axes(vertices)), position(T(0), T(0)), rotation(T(0)) { 
+        TINY_COLLS_STAT(allocations, 1);
+        transform();
+    }
+
+    // For factories that already know their edge normals.
+    Impl(std::vector<vec<T>> vertices, std::vector<vec<T>> axes)
+        : vertices(vertices), axes(axes), position(T(0), T(0)), rotation(T(0)) {
+        TINY_COLLS_STAT(allocations, 1);
         transform();
     }
     
@@ -29,7 +44,7 @@ struct collider<T>::Impl {
             auto b = vertices[(i + 1) % vertices.size()];
 
             vec<T> edge = b - a;
-            if (edge.dot(edge) < 1e-7)
+            if (edge.largest() < details::edge_epsilon<T>())
                 continue;
 
             axes.push_back(edge.perp().normalize());
@@ -39,40 +54,70 @@ struct collider<T>::Impl {
     }
 
     void transform() {
-        t_vertices.clear();
-        t_axes.clear();
+        TINY_COLLS_STAT(transforms, 1);
+        transform_id = next_transform_id.fetch_add(1, std::memory_order_relaxed) + 1;
+        TINY_COLLS_STAT(allocations, (t_vertices.capacity() < vertices.size()) + (t_axes.capacity() < axes.size()));
+
+        auto m = world_matrix();
+        t_vertices.resize(vertices.size(), vec<T>());
+        t_aabb = details::transform_points_bounded(
+            vertices.data(), t_vertices.data(), vertices.size(), m[0], m[1], m[2], m[3], this->position.x, this->position.y
+        );
+        transform_axes(axes, t_axes, m);
+
+        lod_dirty = true;
+    }
 
-        for (const auto& v : vertices) {
-            t_vertices.push_back(v.rotate(this->rotation) + this->position); 
+    // Levels are only needed by lod queries, so they follow the full shape lazily.
+    void ensure_lod_transformed() {
+        ensure_transformed();
+        if (!lod_dirty) return;
+
+        auto m = world_matrix();
+        for (auto& level : lods) {
+            level.t_vertices.resize(level.vertices.size(), vec<T>());
+            details::transform_points(
+                level.vertices.data(), level.t_vertices.data(), level.vertices.size(),
+                m[0], m[1], m[2], m[3], this->position.x, this->position.y
+            );
+            transform_axes(level.axes, level.t_axes, m);
         }
+        lod_dirty = false;
+    }
 
-        t_axes = calculate_axes(t_vertices);
+    // Rotation applied after the shape matrix, row major.
+    std::array<T, 4> world_matrix() const {
+        T c = details::cos(this->rotation);
+        T s = details::sin(this->rotation);
+        if (!scaled) return { c, -s, s, c };
 
-        proj<T> x_aabb = project(vec<T>(1, 0));
-        proj<T> y_aabb = project(vec<T>(0, 1));
-    
-        t_aabb.top = y_aabb.max;
-        t_aabb.bottom = y_aabb.min;
-        t_aabb.left = x_aabb.min;
-        t_aabb.right = x_aabb.max;
+        return {
+            c * shape[0] - s * shape[2], c * shape[1] - s * shape[3],
+            s * shape[0] + c * shape[2], s * shape[1] + c * shape[3],
+        };
     }
 
-    const std::vector<vec<T>>& get_axes() const { return t_axes; }
-    proj<T> project(const vec<T>& axis) const {
-        // TODO 
-        T min = std::numeric_limits<T>::max();
-        T max = std::numeric_limits<T>::lowest();
-
-        for (const auto& v : this->t_vertices) {
-            T dot = axis.dot(v);
+    void transform_axes(const std::vector<vec<T>>& in, std::vector<vec<T>>& out, const std::array<T, 4>& m) const {
+        out.resize(in.size(), vec<T>());
 
-            if (dot < min)
-                min = dot;
-            if (dot > max)
-                max = dot;
+        // Rotation keeps edge lengths, so the local axes only need rotating.
+        if (!scaled) {
+            details::transform_points(in.data(), out.data(), in.size(), m[0], m[1], m[2], m[3], T(0), T(0));
+            return;
         }
 
-        return proj<T>(min, max);
+        // Otherwise normals follow the inverse transpose, the cofactor matrix
+        // up to scale, and need normalizing again. The scale is the
+        // determinant, so a mirroring matrix needs the cofactor negated to
+        // keep the normals pointing inward.
+        T sign = m[0] * m[3] - m[1] * m[2] < T(0) ? T(-1) : T(1);
+        details::transform_points(in.data(), out.data(), in.size(), sign * m[3], -sign * m[2], -sign * m[1], sign * m[0], T(0), T(0));
+        for (auto& a : out) a = a.normalize();
+    }
+
+    const std::vector<vec<T>>& get_axes() const { return t_axes; }
+    proj<T> project(const vec<T>& axis) const {
+        return details::project(std::span<const vec<T>>(t_vertices), axis);
     }
 
     void ensure_transformed() {
@@ -82,19 +127,40 @@ struct collider<T>::Impl {
     }
 
     std::vector<vec<T>> vertices;
+    std::vector<vec<T>> axes;
     vec<T> position;
     T rotation;
+    // Local scale or shear applied before rotation, row major.
+    std::array<T, 4> shape { T(1), T(0), T(0), T(1) };
+    bool scaled = false;
     
     std::vector<vec<T>> t_vertices;
     std::vector<vec<T>> t_axes;
     AABB<T> t_aabb;
 
+    // Coarser polygons enclosing the shape, coarsest first.
+    struct lod_level {
+        std::vector<vec<T>> vertices;
+        std::vector<vec<T>> axes;
+        std::vector<vec<T>> t_vertices;
+        std::vector<vec<T>> t_axes;
+    };
+    std::vector<lod_level> lods;
+
+    // Unique per transform across all colliders, so pair caches can tell
+    // whether the transformed shape changed, even after reassignment.
+    uint64_t transform_id = 0;
+    static inline std::atomic<uint64_t> next_transform_id = 0;
+
     bool dirty = false;
+    bool lod_dirty = true;
 };
 
 
 template<typename T>
-collider<T>::collider(const collider& c) : impl(c.impl ? std::make_unique<Impl>(*c.impl) : nullptr) { }
+collider<T>::collider(const collider& c) : impl(c.impl ? std::make_unique<Impl>(*c.impl) : nullptr) { 
+    TINY_COLLS_STAT(allocations, c.impl ? 1 : 0);
+}
 
 template<typename T>
 collider<T>& collider<T>::operator=(const collider& c) {
@@ -103,6 +169,7 @@ collider<T>& collider<T>::operator=(const collider& c) {
     }
     
     impl = c.impl ? std::make_unique<Impl>(*c.impl) : nullptr;
+    TINY_COLLS_STAT(allocations, c.impl ? 1 : 0);
     return *this;
 }
 
@@ -127,21 +194,113 @@ collider<T>& collider<T>::set_rotation(T rotation) {
     return *this;
 };
 
+template <typename T>
+collider<T>& collider<T>::set_scale(T scale) {
+    return set_scale(scale, scale);
+}
+
+template <typename T>
+collider<T>& collider<T>::set_scale(T sx, T sy) {
+    if (!this->impl) {
+        throw std::logic_error("Trying to set scale on non-initialized collider.");
+    }
+    if (sx == T(0) || sy == T(0)) {
+        throw std::invalid_argument("Scale must not be zero.");
+    }
+    this->impl->shape = { sx, T(0), T(0), sy };
+    this->impl->scaled = !(sx == T(1) && sy == T(1));
+    this->impl->dirty = true;
+    return *this;
+}
+
+template <typename T>
+collider<T>& collider<T>::set_transform(const affine<T>& m) {
+    if (!this->impl) {
+        throw std::logic_error("Trying to set transform on non-initialized collider.");
+    }
+    if (m.m00 * m.m11 - m.m01 * m.m10 == T(0)) {
+        throw std::invalid_argument("Transform must be invertible.");
+    }
+    this->impl->position = vec<T>(m.tx, m.ty);
+    this->impl->rotation = T(0);
+    this->impl->shape = { m.m00, m.m01, m.m10, m.m11 };
+    this->impl->scaled = !(m.m00 == T(1) && m.m01 == T(0) && m.m10 == T(0) && m.m11 == T(1));
+    this->impl->dirty = true;
+    return *this;
+}
+
+template <typename T>
+void collider<T>::set_transforms(std::span<collider> colliders, std::span<const affine<T>> transforms) {
+    if (colliders.size() != transforms.size()) {
+        throw std::invalid_argument("Need one transform per collider.");
+    }
+    for (size_t i = 0; i < colliders.size(); i++) {
+        colliders[i].set_transform(transforms[i]);
+    }
+}
+
+template <typename T>
+point<T> collider<T>::get_position() const {
+    if (!this->impl) {
+        throw std::logic_error("Cannot get position from non-initialized collider.");
+    }
+    return { impl->position.x, impl->position.y };
+}
+
+template <typename T>
+T collider<T>::get_rotation() const {
+    if (!this->impl) {
+        throw std::logic_error("Cannot get rotation from non-initialized collider.");
+    }
+    return impl->rotation;
+}
+
 template <typename T>
 std::vector<point<T>> collider<T>::get_shape() const { 
     if (!this->impl) {
         throw std::logic_error("Cannot get shape from non-initialized collider.");
     }
-    impl->ensure_transformed();
 
-    std::vector<point<T>> shape;
-    for (auto vert : impl->t_vertices) {
-        shape.push_back({ vert.x, vert.y });
-    }
-    
+    std::vector<point<T>> shape(impl->vertices.size());
+    TINY_COLLS_STAT(allocations, 1);
+    get_shape(shape);
     return shape; 
 } 
 
+template <typename T>
+size_t collider<T>::get_shape(std::span<point<T>> out) const {
+    if (!this->impl) {
+        throw std::logic_error("Cannot get shape from non-initialized collider.");
+    }
+    impl->ensure_transformed();
+
+    size_t n = std::min(out.size(), impl->t_vertices.size());
+    for (size_t i = 0; i < n; i++) {
+        out[i] = { impl->t_vertices[i].x, impl->t_vertices[i].y };
+    }
+    return impl->t_vertices.size();
+}
+
+template <typename T>
+shape_view<T> collider<T>::get_shape_view() const {
+    if (!this->impl) {
+        throw std::logic_error("Cannot get shape from non-initialized collider.");
+    }
+    impl->ensure_transformed();
+
+    return shape_view<T>(impl->t_vertices.data(), impl->t_vertices.size());
+}
+
+template <typename T>
+shape_view<T> collider<T>::get_axes_view() const {
+    if (!this->impl) {
+        throw std::logic_error("Cannot get axes from non-initialized collider.");
+    }
+    impl->ensure_transformed();
+
+    return shape_view<T>(impl->t_axes.data(), impl->t_axes.size());
+}
+
 template <typename T>
 AABB<T> collider<T>::get_bounding_box() const {
     if (!this->impl) {
@@ -161,20 +320,35 @@ std::vector<T> collider<T>::get_raw() const {
     if (!this->impl) {
         throw std::logic_error("Cannot get raw data from non-initialized collider.");
     }
-    std::vector<T> raw;
-    raw.reserve(3 + impl->vertices.size() * T(2));
-    
-    raw.push_back(impl->position.x);
-    raw.push_back(impl->position.y);
+
+    std::vector<T> raw(3 + impl->vertices.size() * 2);
+    TINY_COLLS_STAT(allocations, 1);
+    get_raw(raw);
+    return raw;
+}
+
+template <typename T>
+size_t collider<T>::get_raw(std::span<T> out) const {
+    if (!this->impl) {
+        throw std::logic_error("Cannot get raw data from non-initialized collider.");
+    }
+    size_t size = 3 + impl->vertices.size() * 2;
+    size_t i = 0;
+    auto put = [&](T v) { if (i < out.size()) out[i++] = v; };
+
+    put(impl->position.x);
+    put(impl->position.y);
     
-    raw.push_back(impl->rotation);
+    put(impl->rotation);
 
+    // Scale is baked into the vertices so raw() rebuilds the same shape.
+    const auto& m = impl->shape;
     for (auto& v : impl->vertices) {
-        raw.push_back(v.x);
-        raw.push_back(v.y);
+        put(m[0] * v.x + m[1] * v.y);
+        put(m[2] * v.x + m[3] * v.y);
     }
 
-    return raw;
+    return size;
 }
 
 template <typename T>
@@ -184,19 +358,39 @@ bool collider<T>::is_point_in(T x, T y) {
     }
     impl->ensure_transformed();
 
-    const std::vector<vec<T>>& axes = impl->get_axes();
-    vec<T> point = vec<T>(x, y);
+    return details::contains_point(
+        std::span<const vec<T>>(impl->t_vertices), std::span<const vec<T>>(impl->t_axes), vec<T>(x, y)
+    );
+}
 
-    for (auto& axis : axes) {
-        proj<T> this_proj = impl->project(axis);
-        T point_d = axis.dot(point);
+template <typename T>
+size_t collider<T>::is_point_in(std::span<const point<T>> points, std::span<bool> out) {
+    if (!this->impl) {
+        throw std::logic_error("Cannot check is point in on non-initialized collider.");
+    }
+    if (out.size() != points.size()) {
+        throw std::invalid_argument("Point test output must be as long as the points.");
+    }
+    impl->ensure_transformed();
 
-        if (this_proj.max < point_d || point_d < this_proj.min) {
-            return false;
-        }
+    const auto& vertices = impl->t_vertices;
+    const auto& axes = impl->t_axes;
+    if constexpr (details::has_kernels<T>) {
+        static_assert(sizeof(point<T>) == 2 * sizeof(T));
+        return details::kernels<T>().points_in(
+            details::flat(vertices.data()), vertices.size(), details::flat(axes.data()), axes.size(),
+            reinterpret_cast<const T*>(points.data()), points.size(), out.data()
+        );
     }
 
-    return true;
+    size_t inside = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+        out[i] = details::contains_point(
+            std::span<const vec<T>>(vertices), std::span<const vec<T>>(axes), vec<T>(points[i].x, points[i].y)
+        );
+        inside += out[i];
+    }
+    return inside;
 }
 
 template <typename T>
@@ -211,49 +405,131 @@ bool collider<T>::is_colliding_with(const collider<T>& other, collision<T>& out)
     other.impl->ensure_transformed();
 
 
-    std::vector<vec<T>> axes = this->impl->get_axes();
-    std::vector<vec<T>> other_axes = other.impl->get_axes();
+    return details::sat(
+        std::span<const vec<T>>(this->impl->t_vertices), std::span<const vec<T>>(this->impl->t_axes), this->impl->position,
+        std::span<const vec<T>>(other.impl->t_vertices), std::span<const vec<T>>(other.impl->t_axes), other.impl->position,
+        out
+    );
+}
+
+template <typename T>
+collider<T>& collider<T>::set_lod_levels(const std::vector<int>& vertex_counts) {
+    if (!this->impl) {
+        throw std::logic_error("Cannot set lod levels on non-initialized collider.");
+    }
+
+    std::vector<int> counts;
+    for (int n : vertex_counts) {
+        if (n < 3) {
+            throw std::invalid_argument("Lod vertex count must be 3 or higher!");
+        }
+        if (size_t(n) < impl->vertices.size()) counts.push_back(n);
+    }
+    std::sort(counts.begin(), counts.end());
+    counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+
+    impl->lods.clear();
+    for (int n : counts) {
+        auto vertices = details::enclosing_polygon(impl->vertices, size_t(n));
+        if (vertices.size() >= impl->vertices.size()) continue; // Could not coarsen
 
-    axes.insert(axes.end(), other_axes.begin(), other_axes.end());
+        auto axes = Impl::calculate_axes(vertices);
+        impl->lods.push_back({ std::move(vertices), std::move(axes), {}, {} });
+    }
+    impl->lod_dirty = true;
+    return *this;
+}
 
-    if (axes.empty()) return false; // Nothing to check?
+template <typename T>
+size_t collider<T>::get_lod_count() const {
+    if (!this->impl) {
+        throw std::logic_error("Cannot get lod levels from non-initialized collider.");
+    }
+    return impl->lods.size();
+}
 
-    T smallest_overlap = std::numeric_limits<T>::max();
-    vec<T> overlap_axis(0, 0);
-    for (auto& axis : axes) {
-        proj<T> this_proj = this->impl->project(axis);
-        proj<T> other_proj = other.impl->project(axis);
+template <typename T>
+bool collider<T>::is_colliding_with_lod(const collider<T>& other, collision<T>& out) {
+    if (!this->impl || !other.impl) {
+        throw std::logic_error("Cannot check collision on non-initialized collider.");
+    }
+
+    if (this == &other) return false;
 
-        if (this_proj.max < other_proj.min || other_proj.max < this_proj.min) {
+    this->impl->ensure_lod_transformed();
+    other.impl->ensure_lod_transformed();
+
+    // A level encloses the finer ones, so a separated level rules out the pair.
+    // A side with fewer levels keeps testing with its full shape.
+    size_t levels = std::max(this->impl->lods.size(), other.impl->lods.size());
+    for (size_t i = 0; i < levels; i++) {
+        const Impl& a = *this->impl;
+        const Impl& b = *other.impl;
+        bool a_full = i >= a.lods.size();
+        bool b_full = i >= b.lods.size();
+
+        collision<T> coarse;
+        if (!details::sat(
+            std::span<const vec<T>>(a_full ? a.t_vertices : a.lods[i].t_vertices),
+            std::span<const vec<T>>(a_full ? a.t_axes : a.lods[i].t_axes), a.position,
+            std::span<const vec<T>>(b_full ? b.t_vertices : b.lods[i].t_vertices),
+            std::span<const vec<T>>(b_full ? b.t_axes : b.lods[i].t_axes), b.position,
+            coarse
+        )) {
             return false;
-        } else {
-            T overlap0 = this_proj.max - other_proj.min;
-            T overlap1 = other_proj.max - this_proj.min;
-
-            T overlap = (overlap0 < overlap1) ? overlap0 : -overlap1;
-            if (std::abs(overlap) < std::abs(smallest_overlap)) {
-                smallest_overlap = overlap;
-                overlap_axis = axis;
-            }
         }
     }
 
-    vec<T> delta = this->impl->position - other.impl->position;
+    return details::sat(
+        std::span<const vec<T>>(this->impl->t_vertices), std::span<const vec<T>>(this->impl->t_axes), this->impl->position,
+        std::span<const vec<T>>(other.impl->t_vertices), std::span<const vec<T>>(other.impl->t_axes), other.impl->position,
+        out
+    );
+}
 
-    if (delta.dot(overlap_axis) < 0) {
-        overlap_axis = -overlap_axis;
+template <typename T>
+bool collider<T>::is_colliding_with_mixed(const collider<T>& other, collision<T>& out) requires std::is_floating_point_v<T> {
+    if (!this->impl || !other.impl) {
+        throw std::logic_error("Cannot check collision on non-initialized collider.");
     }
 
-    out = collision<T> { overlap_axis.x, overlap_axis.y, smallest_overlap };
-    return true;
+    if (this == &other) return false;
+
+    this->impl->ensure_transformed();
+    other.impl->ensure_transformed();
+
+    // Disjoint boxes settle most pairs before converting any vertex.
+    const AABB<T>& a = this->impl->t_aabb;
+    const AABB<T>& b = other.impl->t_aabb;
+    if (a.right < b.left || b.right < a.left || a.top < b.bottom || b.top < a.bottom) return false;
+
+    return details::sat_mixed(
+        std::span<const vec<T>>(this->impl->t_vertices), std::span<const vec<T>>(this->impl->t_axes), this->impl->position,
+        std::span<const vec<T>>(other.impl->t_vertices), std::span<const vec<T>>(other.impl->t_axes), other.impl->position,
+        out
+    );
+}
+
+template <typename T>
+void collider<T>::update_transforms(std::span<collider> colliders, unsigned workers) {
+    details::parallel_for(colliders.size(), [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            if (colliders[i].impl) colliders[i].impl->ensure_transformed();
+        }
+    }, workers);
 }
 
 template <typename T>
 void collider<T>::set_ellipse_vertex_count(int count) { 
+    check_vertex_count(count);
+    ellipse_vertex_count = std::max(count, 8); 
+}
+
+template <typename T>
+void collider<T>::check_vertex_count(int count) {
     if (count < 8) {
         throw std::invalid_argument("Ellipse vertex count must be at least 8");
     } 
-    ellipse_vertex_count = std::max(count, 8); 
 }
 
 template <typename T>
@@ -277,16 +553,25 @@ collider<T> collider<T>::poly(T width, T height, int N) {
         throw std::invalid_argument("Vertex count must be 3 or higher!");
     }
 
-    T step = T(2) * std::numbers::pi_v<T> / T(N);
+    auto unit = details::make_unit_polygon<T>(N);
+    return collider<T>(std::make_unique<Impl>(details::scaled<T>(unit, width / T(2), height / T(2))));
+}
 
-    std::vector<vec<T>> vertices;
-    vertices.reserve(N);
+template <typename T>
+template <int N>
+collider<T> collider<T>::poly(T width, T height) {
+    static_assert(N > 2, "Vertex count must be 3 or higher!");
 
+    constexpr auto& unit = details::unit_polygon<T, N>;
     T half_width = width / T(2);
     T half_height = height / T(2);
+    auto vertices = details::scaled<T>(unit, half_width, half_height);
 
-    for (int i = 0; i < N; i++) {
-        vertices.push_back(vec<T>(half_width * std::cos(step * i), half_height * std::sin(step * i)));
+    // Regular polygons keep the unit normals, skipping the per edge sqrt.
+    T side = T(2) * half_width * T(details::const_sin(std::numbers::pi_v<double> / N));
+    if (half_width == half_height && side >= details::edge_epsilon<T>()) {
+        constexpr auto& normals = details::unit_normals<T, N>;
+        return collider<T>(std::make_unique<Impl>(vertices, details::scaled<T>(normals, T(1), T(1))));
     }
 
     return collider<T>(std::make_unique<Impl>(vertices));
@@ -294,7 +579,20 @@ collider<T> collider<T>::poly(T width, T height, int N) {
 
 template <typename T>
 collider<T> collider<T>::ellipse(T a, T b) {
-    return poly(a * T(2), b * T(2), ellipse_vertex_count);
+    return ellipse(a, b, ellipse_vertex_count);
+}
+
+template <typename T>
+collider<T> collider<T>::ellipse(T a, T b, int vertex_count) {
+    check_vertex_count(vertex_count);
+    return poly(a * T(2), b * T(2), vertex_count);
+}
+
+template <typename T>
+template <int N>
+collider<T> collider<T>::ellipse(T a, T b) {
+    static_assert(N >= 8, "Ellipse vertex count must be at least 8");
+    return poly<N>(a * T(2), b * T(2));
 }
 
 template <typename T>
@@ -303,118 +601,85 @@ collider<T> collider<T>::circle(T radius) {
 }
 
 template <typename T>
-collider<T> collider<T>::capsule(T width, T height) {
-    T radius = width / T(2);
-    T step = T(2) * std::numbers::pi_v<T> / T(ellipse_vertex_count);
-    vec<T> cursor = vec<T>(0, radius - height / T(2));
+collider<T> collider<T>::circle(T radius, int vertex_count) {
+    return ellipse(radius, radius, vertex_count);
+}
 
-    std::vector<vec<T>> vertices;
+template <typename T>
+template <int N>
+collider<T> collider<T>::circle(T radius) {
+    return ellipse<N>(radius, radius);
+}
 
-    int i = 0;
-    for (; i < ellipse_vertex_count / 2; i++) {
-        vec<T> o = vec<T>(radius * std::cos(step * i), radius * std::sin(step * i));
-        vertices.push_back(cursor + o);
-    }
+template <typename T>
+collider<T> collider<T>::capsule(T width, T height) {
+    return capsule(width, height, ellipse_vertex_count);
+}
 
-    cursor = vec<T>(0, height / T(2) - radius);
+template <typename T>
+collider<T> collider<T>::capsule(T width, T height, int vertex_count) {
+    check_vertex_count(vertex_count);
 
-    for (; i < ellipse_vertex_count; i++) {
-        vec<T> o = vec<T>(radius * std::cos(step * i), radius * std::sin(step * i));
-        vertices.push_back(cursor + o);
-    }
+    auto unit = details::make_unit_polygon<T>(vertex_count);
+    return collider<T>(std::make_unique<Impl>(details::capsule_vertices<T>(unit, width, height)));
+}
 
-    return collider<T>(std::make_unique<Impl>(vertices));
-} 
+template <typename T>
+template <int N>
+collider<T> collider<T>::capsule(T width, T height) {
+    static_assert(N >= 8, "Ellipse vertex count must be at least 8");
+
+    constexpr auto& unit = details::unit_polygon<T, N>;
+    return collider<T>(std::make_unique<Impl>(details::capsule_vertices<T>(unit, width, height)));
+}
 
 template <typename T>
 collider<T> collider<T>::line(T length) {
-    return collider<T>::rect(0, length);
+    return collider<T>::rect(T(0), length);
 }
 
 template <typename T>
 collider<T> collider<T>::rounded_rect(T width, T height, T roundness) {
+    return rounded_rect(width, height, roundness, ellipse_vertex_count);
+}
+
+template <typename T>
+collider<T> collider<T>::rounded_rect(T width, T height, T roundness, int vertex_count) {
     if (roundness < T(0) || roundness > T(1)) {
         throw std::invalid_argument("Roundness should be between [0, 1].");
     }
-    
-    T half_width = width / T(2);
-    T half_height = height / T(2);
-
-    T radius_x = roundness * half_width;
-    T radius_y = roundness * half_height;
-
-    int corner_n = ellipse_vertex_count / 4;
-    assert(corner_n > 1 && "Too few vertices to create rounded rectangles");
-
-    T step = std::numbers::pi_v<T> / (T(corner_n) * T(2));
-
-    const std::array<vec<T>, 4> corners = {
-        vec<T>(half_width - radius_x, half_height - radius_y),
-        vec<T>(-half_width + radius_x, half_height - radius_y),
-        vec<T>(-half_width + radius_x, -half_height + radius_y),
-        vec<T>(half_width - radius_x, -half_height + radius_y),
-    };
+    check_vertex_count(vertex_count);
 
-    const T corner_rot[4] = {
-        T(0),
-        std::numbers::pi_v<T> / T(2),
-        std::numbers::pi_v<T>,
-        T(3) * std::numbers::pi_v<T> / T(2),
-    };
+    auto unit = details::make_unit_polygon<T>(vertex_count / 4 * 4);
+    return collider<T>(std::make_unique<Impl>(details::rounded_rect_vertices<T>(unit, width, height, roundness)));
+}
 
-    std::vector<vec<T>> vertices;
-    int i = 0;
-    vec<T> cursor = vec<T>(0, 0);
-    
-    const int SEGS = 4;
-    for (int i = 0; i < SEGS; i++) {
-        cursor = corners[i];
-        for (int j = 0; j < corner_n; j++) {
-            vec<T> o = vec<T>(radius_x * std::cos(corner_rot[i] + step * j), radius_y * std::sin(corner_rot[i] + step * j));
-            vertices.push_back(cursor + o);
-        }
+template <typename T>
+template <int N>
+collider<T> collider<T>::rounded_rect(T width, T height, T roundness) {
+    static_assert(N >= 8, "Ellipse vertex count must be at least 8");
+    if (roundness < T(0) || roundness > T(1)) {
+        throw std::invalid_argument("Roundness should be between [0, 1].");
     }
 
-    return collider<T>(std::make_unique<Impl>(vertices));
+    constexpr auto& unit = details::unit_polygon<T, N / 4 * 4>;
+    return collider<T>(std::make_unique<Impl>(details::rounded_rect_vertices<T>(unit, width, height, roundness)));
 }
 
 template <typename T>
 collider<T> collider<T>::from_points(const std::vector<point<T>>& points) {
-    // Monotone chain algo
+    return from_points(points, hull_options<T>());
+}
 
+template <typename T>
+collider<T> collider<T>::from_points(const std::vector<point<T>>& points, const hull_options<T>& options) {
     std::vector<vec<T>> vertices;
+    vertices.reserve(points.size());
     for (const auto& p : points) {
         vertices.push_back(vec<T>(p.x, p.y));
     }
 
-    if (vertices.size() <= 3) return collider<T>(std::make_unique<Impl>(vertices));
-
-    std::sort(vertices.begin(), vertices.end());
-
-    auto cross = [](const vec<T> &o, const vec<T> &a, const vec<T> &b) {
-        return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (a.x - o.x); 
-    };
-    
-    std::vector<vec<T>> hull(2 * vertices.size());
-
-    int k = 0; 
-
-    // Build lower hull
-    for (int i = 0; i < vertices.size(); i++) {
-        while (k >= 2 && cross(hull[k - 2], hull[k-1], vertices[i]) <= 0) k--;
-        hull[k++] = vertices[i];
-    }
-
-    
-    // Build lower hull
-    for (int i = vertices.size() - 1, t = k + 1; i > 0; i--) {
-        while (k >= t && cross(hull[k - 2], hull[k-1], vertices[i - 1]) <= 0) k--;
-        hull[k++] = vertices[i - 1];
-    }
-    
-    hull.resize(k - 1);
-
-    return collider<T>(std::make_unique<Impl>(hull));
+    return collider<T>(std::make_unique<Impl>(details::convex_hull(std::move(vertices), options)));
 }
 
 template <typename T>
@@ -428,17 +693,17 @@ collider<T> collider<T>::raw(const std::vector<T>& data) {
     T y = data[i++];
     T rotation = data[i++];
 
-    int v_len = (data.size() - 3) / 2;
-    if (v_len % 2) {
+    if ((data.size() - 3) % 2) {
         throw std::invalid_argument("Uneven vertices vector in raw collider data.");
     }
+    int v_len = (data.size() - 3) / 2;
 
     std::vector<vec<T>> vertices;
     vertices.reserve(v_len);
 
     for (; i < data.size(); i += 2) {
-        if (!std::isfinite(data[i])) throw std::invalid_argument("Vertex containing non numeric value.");
-        if (!std::isfinite(data[i + 1])) throw std::invalid_argument("Vertex containing non numeric value.");
+        if (!details::isfinite(data[i])) throw std::invalid_argument("Vertex containing non numeric value.");
+        if (!details::isfinite(data[i + 1])) throw std::invalid_argument("Vertex containing non numeric value.");
 
         vertices.push_back(vec<T>(data[i], data[i + 1]));
     }
@@ -450,6 +715,6 @@ template <typename T>
 collider<T>::collider(std::unique_ptr<Impl> impl) : impl(std::move(impl)) { } 
 
 template <typename T>
-int collider<T>::ellipse_vertex_count = 16;
+std::atomic<int> collider<T>::ellipse_vertex_count = 16;
 
 }
\ No newline at end of file
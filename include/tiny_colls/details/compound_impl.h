@@ -0,0 +1,369 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include "tiny_colls/details/vec.h"
+
+namespace tiny_colls {
+template <typename T>
+compound<T>::compound(const std::vector<std::vector<point<T>>>& shapes) {
+    if (shapes.empty()) {
+        throw std::invalid_argument("Compound needs at least one part.");
+    }
+
+    for (const auto& shape : shapes) {
+        parts.push_back(collider<T>::from_points(shape));
+    }
+
+    std::vector<uint32_t> order(parts.size());
+    std::iota(order.begin(), order.end(), 0);
+    nodes.reserve(2 * parts.size() - 1);
+    build(order, 0, order.size());
+}
+
+template <typename T>
+compound<T>& compound<T>::set_position(T x, T y) {
+    this->x = x;
+    this->y = y;
+    dirty = true;
+    return *this;
+}
+
+template <typename T>
+compound<T>& compound<T>::set_rotation(T rotation) {
+    this->rotation = rotation;
+    dirty = true;
+    return *this;
+}
+
+template <typename T>
+AABB<T> compound<T>::get_bounding_box() const {
+    if (nodes.empty()) {
+        throw std::logic_error("Cannot get bounding box from non-initialized compound.");
+    }
+    ensure_transformed();
+    return nodes[0].box;
+}
+
+template <typename T>
+const std::vector<collider<T>>& compound<T>::get_parts() const {
+    ensure_transformed();
+    return parts;
+}
+
+template <typename T>
+bool compound<T>::is_point_in(T x, T y) {
+    if (nodes.empty()) {
+        throw std::logic_error("Cannot check is point in on non-initialized compound.");
+    }
+    ensure_transformed();
+
+    std::array<int32_t, max_depth + 1> stack;
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const node& n = nodes[stack[--top]];
+
+        if (x < n.box.left || n.box.right < x || y < n.box.bottom || n.box.top < y) continue;
+
+        if (n.part >= 0) {
+            if (parts[n.part].is_point_in(x, y)) return true;
+        } else {
+            stack[top++] = n.left;
+            stack[top++] = n.right;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+bool compound<T>::is_colliding_with(const compound& other, collision<T>& out) {
+    bool hit = false;
+    for_each_part_contact(other, [&](size_t, size_t, const collision<T>& c) {
+        if (!hit || details::abs(out.overlap) < details::abs(c.overlap)) {
+            out = c;
+        }
+        hit = true;
+    });
+    return hit;
+}
+
+template <typename T>
+bool compound<T>::is_colliding_with(const collider<T>& other, collision<T>& out) {
+    if (nodes.empty()) {
+        throw std::logic_error("Cannot check collision on non-initialized compound.");
+    }
+    ensure_transformed();
+    AABB<T> box = other.get_bounding_box();
+
+    bool hit = false;
+    std::array<int32_t, max_depth + 1> stack;
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const node& n = nodes[stack[--top]];
+
+        if (n.box.right < box.left || box.right < n.box.left) continue;
+        if (n.box.top < box.bottom || box.top < n.box.bottom) continue;
+
+        if (n.part < 0) {
+            stack[top++] = n.left;
+            stack[top++] = n.right;
+            continue;
+        }
+
+        collision<T> c;
+        if (parts[n.part].is_colliding_with(other, c)) {
+            if (!hit || details::abs(out.overlap) < details::abs(c.overlap)) {
+                out = c;
+            }
+            hit = true;
+        }
+    }
+    return hit;
+}
+
+template <typename T>
+template <typename F>
+void compound<T>::for_each_part_contact(const compound& other, F&& f) {
+    if (nodes.empty() || other.nodes.empty()) {
+        throw std::logic_error("Cannot check collision on non-initialized compound.");
+    }
+    if (this == &other) return;
+
+    ensure_transformed();
+    other.ensure_transformed();
+
+    // Simultaneous descent of both trees, always splitting the larger box.
+    std::array<std::pair<int32_t, int32_t>, 2 * max_depth + 1> stack;
+    size_t top = 0;
+    stack[top++] = { 0, 0 };
+    while (top > 0) {
+        auto [i, j] = stack[--top];
+
+        const node& a = nodes[i];
+        const node& b = other.nodes[j];
+
+        if (a.box.right < b.box.left || b.box.right < a.box.left) continue;
+        if (a.box.top < b.box.bottom || b.box.top < a.box.bottom) continue;
+
+        if (a.part >= 0 && b.part >= 0) {
+            collision<T> c;
+            if (parts[a.part].is_colliding_with(other.parts[b.part], c)) {
+                f(size_t(a.part), size_t(b.part), c);
+            }
+            continue;
+        }
+
+        T a_size = (a.box.right - a.box.left) + (a.box.top - a.box.bottom);
+        T b_size = (b.box.right - b.box.left) + (b.box.top - b.box.bottom);
+
+        if (b.part >= 0 || (a.part < 0 && b_size < a_size)) {
+            stack[top++] = { a.left, j };
+            stack[top++] = { a.right, j };
+        } else {
+            stack[top++] = { i, b.left };
+            stack[top++] = { i, b.right };
+        }
+    }
+}
+
+template <typename T>
+compound<T> compound<T>::from_polygon(const std::vector<point<T>>& polygon) {
+    return compound<T>(decompose(polygon));
+}
+
+// Nodes are stored in pre-order, children always after their parent, so a
+// refit is a single reverse sweep.
+template <typename T>
+int32_t compound<T>::build(std::vector<uint32_t>& order, size_t begin, size_t end) {
+    int32_t index = static_cast<int32_t>(nodes.size());
+    nodes.emplace_back();
+
+    if (end - begin == 1) {
+        nodes[index].part = static_cast<int32_t>(order[begin]);
+        nodes[index].box = parts[order[begin]].get_bounding_box();
+        return index;
+    }
+
+    auto center = [&](uint32_t part, bool x_axis) {
+        AABB<T> b = parts[part].get_bounding_box();
+        return x_axis ? b.left + b.right : b.bottom + b.top;
+    };
+
+    T min_x = std::numeric_limits<T>::max(), max_x = std::numeric_limits<T>::lowest();
+    T min_y = std::numeric_limits<T>::max(), max_y = std::numeric_limits<T>::lowest();
+    for (size_t i = begin; i < end; i++) {
+        min_x = std::min(min_x, center(order[i], true));
+        max_x = std::max(max_x, center(order[i], true));
+        min_y = std::min(min_y, center(order[i], false));
+        max_y = std::max(max_y, center(order[i], false));
+    }
+    bool x_axis = (max_x - min_x) >= (max_y - min_y);
+
+    size_t mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end, [&](uint32_t l, uint32_t r) {
+        return center(l, x_axis) < center(r, x_axis);
+    });
+
+    int32_t left = build(order, begin, mid);
+    int32_t right = build(order, mid, end);
+    nodes[index].left = left;
+    nodes[index].right = right;
+    return index;
+}
+
+template <typename T>
+void compound<T>::ensure_transformed() const {
+    if (!dirty) return;
+
+    for (auto& part : parts) {
+        part.set_position(x, y).set_rotation(rotation);
+    }
+
+    for (size_t i = nodes.size(); i-- > 0;) {
+        node& n = nodes[i];
+        if (n.part >= 0) {
+            n.box = parts[n.part].get_bounding_box();
+            continue;
+        }
+
+        const AABB<T>& l = nodes[n.left].box;
+        const AABB<T>& r = nodes[n.right].box;
+        n.box = AABB<T> { std::max(l.top, r.top), std::min(l.bottom, r.bottom), std::min(l.left, r.left), std::max(l.right, r.right) };
+    }
+
+    dirty = false;
+}
+
+template <typename T>
+std::vector<std::vector<point<T>>> decompose(const std::vector<point<T>>& polygon) {
+    using details::vec;
+
+    std::vector<vec<T>> pts;
+    for (const auto& p : polygon) {
+        vec<T> v(p.x, p.y);
+        if (!pts.empty() && pts.back().x == v.x && pts.back().y == v.y) continue;
+        pts.push_back(v);
+    }
+    if (pts.size() > 1 && pts.front().x == pts.back().x && pts.front().y == pts.back().y) pts.pop_back();
+
+    if (pts.size() < 3) {
+        throw std::invalid_argument("Polygon needs at least 3 vertices.");
+    }
+
+    auto cross = [](const vec<T>& o, const vec<T>& a, const vec<T>& b) {
+        return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+    };
+
+    T area = T(0);
+    for (size_t i = 0; i < pts.size(); i++) {
+        const auto& a = pts[i];
+        const auto& b = pts[(i + 1) % pts.size()];
+        area += a.x * b.y - b.x * a.y;
+    }
+    if (area < T(0)) std::reverse(pts.begin(), pts.end());
+
+    // Ear clipping
+    std::vector<uint32_t> ring(pts.size());
+    std::iota(ring.begin(), ring.end(), 0);
+    std::vector<std::vector<uint32_t>> pieces;
+
+    while (ring.size() > 3) {
+        bool clipped = false;
+        for (size_t i = 0; i < ring.size() && !clipped; i++) {
+            uint32_t prev = ring[(i + ring.size() - 1) % ring.size()];
+            uint32_t cur = ring[i];
+            uint32_t next = ring[(i + 1) % ring.size()];
+
+            T turn = cross(pts[prev], pts[cur], pts[next]);
+            if (turn == T(0)) {
+                ring.erase(ring.begin() + i); // Collinear, drop the vertex
+                clipped = true;
+                continue;
+            }
+            if (turn < T(0)) continue;
+
+            bool ear = true;
+            for (uint32_t k : ring) {
+                if (k == prev || k == cur || k == next) continue;
+                if (cross(pts[prev], pts[cur], pts[k]) >= T(0) &&
+                    cross(pts[cur], pts[next], pts[k]) >= T(0) &&
+                    cross(pts[next], pts[prev], pts[k]) >= T(0)) {
+                    ear = false;
+                    break;
+                }
+            }
+            if (!ear) continue;
+
+            pieces.push_back({ prev, cur, next });
+            ring.erase(ring.begin() + i);
+            clipped = true;
+        }
+
+        if (!clipped) {
+            throw std::invalid_argument("Polygon is not simple.");
+        }
+    }
+    if (cross(pts[ring[0]], pts[ring[1]], pts[ring[2]]) > T(0)) {
+        pieces.push_back(ring);
+    }
+
+    // Hertel-Mehlhorn: drop diagonals whose removal keeps both sides convex.
+    auto is_convex = [&](const std::vector<uint32_t>& piece) {
+        for (size_t i = 0; i < piece.size(); i++) {
+            const auto& a = pts[piece[(i + piece.size() - 1) % piece.size()]];
+            const auto& b = pts[piece[i]];
+            const auto& c = pts[piece[(i + 1) % piece.size()]];
+            if (cross(a, b, c) < T(0)) return false;
+        }
+        return true;
+    };
+
+    auto try_merge = [&](const std::vector<uint32_t>& p, const std::vector<uint32_t>& q, std::vector<uint32_t>& merged) {
+        for (size_t i = 0; i < p.size(); i++) {
+            uint32_t u = p[i];
+            uint32_t v = p[(i + 1) % p.size()];
+            for (size_t j = 0; j < q.size(); j++) {
+                if (q[j] != v || q[(j + 1) % q.size()] != u) continue;
+
+                // p from v around to u, then q from u around to v, without the shared ends.
+                merged.clear();
+                for (size_t k = 0; k < p.size(); k++) merged.push_back(p[(i + 1 + k) % p.size()]);
+                for (size_t k = 2; k < q.size(); k++) merged.push_back(q[(j + k) % q.size()]);
+                return is_convex(merged);
+            }
+        }
+        return false;
+    };
+
+    std::vector<uint32_t> merged;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < pieces.size() && !changed; i++) {
+            for (size_t j = i + 1; j < pieces.size() && !changed; j++) {
+                if (try_merge(pieces[i], pieces[j], merged)) {
+                    pieces[i] = merged;
+                    pieces.erase(pieces.begin() + j);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    std::vector<std::vector<point<T>>> out;
+    out.reserve(pieces.size());
+    for (const auto& piece : pieces) {
+        std::vector<point<T>> shape;
+        shape.reserve(piece.size());
+        for (uint32_t k : piece) shape.push_back({ pts[k].x, pts[k].y });
+        out.push_back(std::move(shape));
+    }
+    return out;
+}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+
+namespace tiny_colls {
+template <typename T>
+void contact_tracker<T>::update(world<T>& w) {
+    next.clear();
+    w.for_each_contact([&](const contact<T>& c) {
+        next.push_back(entry { key_of(c.a, c.b), pair_data { c, 1 } });
+    });
+    std::sort(next.begin(), next.end(), [](const entry& l, const entry& r) { return l.key < r.key; });
+
+    began_events.clear();
+    persisted_events.clear();
+    ended_events.clear();
+
+    // Both lists are sorted by key, walk them together.
+    auto same_pair = [](const contact<T>& l, const contact<T>& r) {
+        return l.a == r.a && l.b == r.b;
+    };
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < current.size() || j < next.size()) {
+        if (j == next.size() || (i < current.size() && current[i].key < next[j].key)) {
+            ended_events.push_back(current[i++].data.last);
+        } else if (i == current.size() || next[j].key < current[i].key) {
+            began_events.push_back(next[j++].data.last);
+        } else if (!same_pair(current[i].data.last, next[j].data.last)) {
+            // A slot was reused by a new collider, the old pair ended.
+            ended_events.push_back(current[i++].data.last);
+            began_events.push_back(next[j++].data.last);
+        } else {
+            next[j].data.frames = current[i].data.frames + 1;
+            persisted_events.push_back(next[j].data.last);
+            i++;
+            j++;
+        }
+    }
+
+    current.swap(next);
+}
+
+template <typename T>
+const std::vector<contact<T>>& contact_tracker<T>::began() const {
+    return began_events;
+}
+
+template <typename T>
+const std::vector<contact<T>>& contact_tracker<T>::persisted() const {
+    return persisted_events;
+}
+
+template <typename T>
+const std::vector<contact<T>>& contact_tracker<T>::ended() const {
+    return ended_events;
+}
+
+template <typename T>
+const typename contact_tracker<T>::pair_data* contact_tracker<T>::find(collider_handle a, collider_handle b) const {
+    if (b.index < a.index) std::swap(a, b);
+
+    uint64_t key = key_of(a, b);
+    auto it = std::lower_bound(current.begin(), current.end(), key, [](const entry& e, uint64_t k) { return e.key < k; });
+    if (it == current.end() || it->key != key) return nullptr;
+    if (!(it->data.last.a == a) || !(it->data.last.b == b)) return nullptr;
+
+    return &it->data;
+}
+
+template <typename T>
+size_t contact_tracker<T>::size() const {
+    return current.size();
+}
+
+template <typename T>
+void contact_tracker<T>::clear() {
+    current.clear();
+    began_events.clear();
+    persisted_events.clear();
+    ended_events.clear();
+}
+
+template <typename T>
+uint64_t contact_tracker<T>::key_of(collider_handle a, collider_handle b) {
+    return (uint64_t(a.index) << 32) | uint64_t(b.index);
+}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include "tiny_colls/details/vec.h"
+
+namespace tiny_colls::details {
+// Hot loops compiled into the library once per instruction set. Points are
+// interleaved x, y pairs.
+template <typename T>
+struct kernel_table {
+    void (*project)(const T* points, size_t n, T axis_x, T axis_y, T& min, T& max);
+    // m holds m00, m01, m10, m11, ox, oy.
+    void (*transform)(const T* in, T* out, size_t n, const T* m);
+    // Also writes the output's min x, min y, max x and max y to box.
+    void (*transform_bounded)(const T* in, T* out, size_t n, const T* m, T* box);
+    // out[i] tells whether point i lies in the convex shape, returns how many do.
+    size_t (*points_in)(const T* vertices, size_t vn, const T* axes, size_t an, const T* points, size_t pn, bool* out);
+};
+
+extern std::atomic<const kernel_table<float>*> kernels_f;
+extern std::atomic<const kernel_table<double>*> kernels_d;
+
+template <typename T>
+inline constexpr bool has_kernels = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Below this many points the call through the table costs more than it saves.
+inline constexpr size_t kernel_min_points = 32;
+
+template <typename T>
+const kernel_table<T>& kernels() {
+    if constexpr (std::is_same_v<T, float>) {
+        return *kernels_f.load(std::memory_order_relaxed);
+    } else {
+        return *kernels_d.load(std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+const T* flat(const vec<T>* v) {
+    static_assert(sizeof(vec<T>) == 2 * sizeof(T));
+    return reinterpret_cast<const T*>(v);
+}
+
+template <typename T>
+T* flat(vec<T>* v) {
+    static_assert(sizeof(vec<T>) == 2 * sizeof(T));
+    return reinterpret_cast<T*>(v);
+}
+}
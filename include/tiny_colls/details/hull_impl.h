@@ -0,0 +1,180 @@
+#pragma once
+
+#include <array>
+#include <queue>
+#include <algorithm>
+#include "tiny_colls/details/vec.h"
+#include "tiny_colls/details/scalar.h"
+#include "tiny_colls/details/parallel.h"
+
+namespace tiny_colls::details {
+template <typename T>
+T cross(const vec<T>& o, const vec<T>& a, const vec<T>& b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+// Akl-Toussaint heuristic: the extreme points in eight directions form a
+// convex octagon, nothing strictly inside it can be on the hull.
+template <typename T>
+void discard_interior(std::vector<vec<T>>& points) {
+    std::array<vec<T>, 8> extremes;
+    extremes.fill(points[0]);
+
+    auto keys = [](const vec<T>& p) {
+        return std::array<T, 8> { -p.x, -(p.x + p.y), -p.y, p.x - p.y, p.x, p.x + p.y, p.y, p.y - p.x };
+    };
+
+    std::array<T, 8> best = keys(points[0]);
+    for (const auto& p : points) {
+        auto k = keys(p);
+        for (size_t d = 0; d < 8; d++) {
+            if (best[d] < k[d]) {
+                best[d] = k[d];
+                extremes[d] = p;
+            }
+        }
+    }
+
+    std::vector<vec<T>> octagon;
+    for (const auto& e : extremes) {
+        if (octagon.empty() || octagon.back().x != e.x || octagon.back().y != e.y) octagon.push_back(e);
+    }
+    while (octagon.size() > 1 && octagon.front().x == octagon.back().x && octagon.front().y == octagon.back().y) {
+        octagon.pop_back();
+    }
+    if (octagon.size() < 3) return;
+
+    std::erase_if(points, [&](const vec<T>& p) {
+        for (size_t i = 0; i < octagon.size(); i++) {
+            if (cross(octagon[i], octagon[(i + 1) % octagon.size()], p) <= T(0)) return false;
+        }
+        return true;
+    });
+}
+
+// Distance from b to the chord a-c, the error of dropping b.
+template <typename T>
+T chord_error(const vec<T>& a, const vec<T>& b, const vec<T>& c) {
+    vec<T> chord = c - a;
+    T length = details::sqrt(chord.dot(chord));
+    if (length == T(0)) return T(0);
+    return details::abs(cross(a, c, b)) / length;
+}
+
+template <typename T>
+void simplify_hull(std::vector<vec<T>>& hull, size_t max_vertices, T max_error) {
+    size_t n = hull.size();
+    if (max_vertices == 0 || n <= max_vertices || n <= 3) return;
+    max_vertices = std::max<size_t>(max_vertices, 3);
+
+    std::vector<size_t> prev(n), next(n), version(n, 0);
+    std::vector<bool> removed(n, false);
+    for (size_t i = 0; i < n; i++) {
+        prev[i] = (i + n - 1) % n;
+        next[i] = (i + 1) % n;
+    }
+
+    struct candidate {
+        T error;
+        size_t index;
+        size_t version;
+        bool operator>(const candidate& o) const { return o.error < error; }
+    };
+
+    // Measured against every original vertex the new chord would span, not
+    // just i, so errors of earlier removals can not add up.
+    auto error_of = [&](size_t i) {
+        const vec<T>& a = hull[prev[i]];
+        const vec<T>& c = hull[next[i]];
+        T worst = T(0);
+        for (size_t j = (prev[i] + 1) % n; j != next[i]; j = (j + 1) % n) {
+            worst = std::max(worst, chord_error(a, hull[j], c));
+        }
+        return worst;
+    };
+
+    std::priority_queue<candidate, std::vector<candidate>, std::greater<candidate>> queue;
+    auto push = [&](size_t i) {
+        queue.push({ error_of(i), i, ++version[i] });
+    };
+    for (size_t i = 0; i < n; i++) push(i);
+
+    size_t remaining = n;
+    while (remaining > max_vertices && !queue.empty()) {
+        candidate c = queue.top();
+        queue.pop();
+        if (removed[c.index] || c.version != version[c.index]) continue;
+        if (max_error < c.error) break;
+
+        removed[c.index] = true;
+        remaining--;
+        next[prev[c.index]] = next[c.index];
+        prev[next[c.index]] = prev[c.index];
+        push(prev[c.index]);
+        push(next[c.index]);
+    }
+
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (!removed[i]) hull[k++] = hull[i];
+    }
+    hull.resize(k);
+}
+
+// Monotone chain
+template <typename T, typename Options>
+std::vector<vec<T>> convex_hull(std::vector<vec<T>> points, const Options& options) {
+    if (options.prefilter && points.size() > 3) discard_interior(points);
+
+    auto less = [](const vec<T>& a, const vec<T>& b) { return a < b; };
+    if (options.parallel) {
+        parallel_sort(points.begin(), points.end(), less);
+    } else {
+        std::sort(points.begin(), points.end(), less);
+    }
+
+    // Small inputs go through the chain too, so they come out sorted,
+    // oriented and free of duplicates like any other.
+    auto same = [](const vec<T>& a, const vec<T>& b) { return a.x == b.x && a.y == b.y; };
+    points.erase(std::unique(points.begin(), points.end(), same), points.end());
+    if (points.size() <= 1) return points;
+
+    std::vector<vec<T>> hull;
+    hull.reserve(points.size() + 1);
+
+    // Build lower hull
+    for (const auto& p : points) {
+        while (hull.size() >= 2 && cross(hull[hull.size() - 2], hull.back(), p) <= T(0)) hull.pop_back();
+        hull.push_back(p);
+    }
+
+    // Build upper hull
+    size_t lower = hull.size() + 1;
+    for (size_t i = points.size() - 1; i > 0; i--) {
+        while (hull.size() >= lower && cross(hull[hull.size() - 2], hull.back(), points[i - 1]) <= T(0)) hull.pop_back();
+        hull.push_back(points[i - 1]);
+    }
+
+    hull.pop_back();
+
+    simplify_hull(hull, options.max_vertices, options.max_error);
+    return hull;
+}
+}
+
+namespace tiny_colls {
+template <typename T>
+std::vector<point<T>> convex_hull(const std::vector<point<T>>& points, const hull_options<T>& options) {
+    std::vector<details::vec<T>> vertices;
+    vertices.reserve(points.size());
+    for (const auto& p : points) {
+        vertices.push_back(details::vec<T>(p.x, p.y));
+    }
+
+    std::vector<point<T>> out;
+    for (const auto& v : details::convex_hull(std::move(vertices), options)) {
+        out.push_back({ v.x, v.y });
+    }
+    return out;
+}
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <vector>
+
+namespace tiny_colls::details {
+// Appends n values read from `in`, growing `out` only as data arrives so a
+// corrupt length can not allocate more than the stream holds. False when the
+// stream ends first.
+template <typename V>
+bool read_values(std::istream& in, std::vector<V>& out, size_t n) {
+    constexpr size_t block = 4096;
+    while (n > 0) {
+        size_t step = std::min(n, block);
+        size_t at = out.size();
+        out.resize(at + step);
+        if (!in.read(reinterpret_cast<char*>(out.data() + at), sizeof(V) * step)) {
+            out.resize(at);
+            return false;
+        }
+        n -= step;
+    }
+    return true;
+}
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <algorithm>
+#include "tiny_colls/details/parallel.h"
+#include "tiny_colls/details/radix_sort.h"
+
+namespace tiny_colls {
+namespace details {
+// Spreads the low 16 bits of v to the even bits.
+inline uint32_t spread_bits(uint32_t v) {
+    v &= 0xFFFF;
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+template <typename T>
+bool overlaps(const AABB<T>& a, const AABB<T>& b) {
+    return !(a.right < b.left || b.right < a.left || a.top < b.bottom || b.top < a.bottom);
+}
+}
+
+template <typename T>
+void lbvh<T>::build(std::span<const AABB<T>> boxes, unsigned workers) {
+    count = boxes.size();
+    nodes.resize(count ? 2 * count - 1 : 0);
+    if (count == 0) return;
+    workers = details::worker_count(workers);
+
+    // Bounds of the box centers, one partial per worker.
+    std::vector<std::array<double, 4>> partial(workers, {
+        std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+    });
+    auto center = [&](size_t i) {
+        return std::pair<double, double>(
+            (static_cast<double>(boxes[i].left) + static_cast<double>(boxes[i].right)) * 0.5,
+            (static_cast<double>(boxes[i].bottom) + static_cast<double>(boxes[i].top)) * 0.5
+        );
+    };
+    details::parallel_for(count, [&](size_t begin, size_t end, unsigned w) {
+        auto& b = partial[w];
+        for (size_t i = begin; i < end; i++) {
+            auto [x, y] = center(i);
+            b = { std::min(b[0], x), std::min(b[1], y), std::max(b[2], x), std::max(b[3], y) };
+        }
+    }, workers);
+
+    std::array<double, 4> bounds = partial[0];
+    for (const auto& b : partial) {
+        bounds = { std::min(bounds[0], b[0]), std::min(bounds[1], b[1]), std::max(bounds[2], b[2]), std::max(bounds[3], b[3]) };
+    }
+    double sx = bounds[2] > bounds[0] ? 65535.0 / (bounds[2] - bounds[0]) : 0.0;
+    double sy = bounds[3] > bounds[1] ? 65535.0 / (bounds[3] - bounds[1]) : 0.0;
+
+    // The box index in the low bits makes every key unique, which the node
+    // emission below relies on.
+    keys.resize(count);
+    details::parallel_for(count, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            auto [x, y] = center(i);
+            uint32_t qx = static_cast<uint32_t>((x - bounds[0]) * sx);
+            uint32_t qy = static_cast<uint32_t>((y - bounds[1]) * sy);
+            uint32_t code = details::spread_bits(qx) | (details::spread_bits(qy) << 1);
+            keys[i] = (uint64_t(code) << 32) | uint64_t(i);
+        }
+    }, workers);
+
+    details::parallel_radix_sort(keys, scratch, workers);
+
+    size_t leaf_base = count - 1;
+    details::parallel_for(count, [&](size_t begin, size_t end, unsigned) {
+        for (size_t p = begin; p < end; p++) {
+            uint32_t item = uint32_t(keys[p]);
+            nodes[leaf_base + p] = node { boxes[item], none, none, none, uint32_t(p), uint32_t(p), item };
+        }
+    }, workers);
+    if (count == 1) return;
+
+    nodes[0].parent = none;
+    details::parallel_for(count - 1, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) emit_internal(uint32_t(i));
+    }, workers);
+
+    // Boxes bottom up: the second child to arrive at a node merges it.
+    if (visits_size < count - 1) {
+        visits = std::make_unique<std::atomic<uint32_t>[]>(count - 1);
+        visits_size = count - 1;
+    }
+    details::parallel_for(count - 1, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) visits[i].store(0, std::memory_order_relaxed);
+    }, workers);
+
+    details::parallel_for(count, [&](size_t begin, size_t end, unsigned) {
+        for (size_t p = begin; p < end; p++) {
+            uint32_t n = nodes[leaf_base + p].parent;
+            while (n != none) {
+                if (visits[n].fetch_add(1, std::memory_order_acq_rel) == 0) break;
+
+                node& nd = nodes[n];
+                const AABB<T>& l = nodes[nd.left].box;
+                const AABB<T>& r = nodes[nd.right].box;
+                nd.box = AABB<T> {
+                    std::max(l.top, r.top), std::min(l.bottom, r.bottom),
+                    std::min(l.left, r.left), std::max(l.right, r.right),
+                };
+                n = nd.parent;
+            }
+        }
+    }, workers);
+}
+
+template <typename T>
+size_t lbvh<T>::size() const {
+    return count;
+}
+
+template <typename T>
+int lbvh<T>::common_prefix(int64_t i, int64_t j) const {
+    if (j < 0 || j >= int64_t(count)) return -1;
+    return std::countl_zero(keys[i] ^ keys[j]);
+}
+
+// Karras 2012: node i covers the longest range starting or ending at leaf i
+// whose keys share a longer prefix than the keys just outside it, split where
+// that prefix grows.
+template <typename T>
+void lbvh<T>::emit_internal(uint32_t index) {
+    int64_t i = index;
+    int64_t d = common_prefix(i, i + 1) > common_prefix(i, i - 1) ? 1 : -1;
+    int delta_min = common_prefix(i, i - d);
+
+    int64_t l_max = 2;
+    while (common_prefix(i, i + l_max * d) > delta_min) l_max *= 2;
+
+    int64_t l = 0;
+    for (int64_t t = l_max / 2; t >= 1; t /= 2) {
+        if (common_prefix(i, i + (l + t) * d) > delta_min) l += t;
+    }
+    int64_t j = i + l * d;
+    int delta_node = common_prefix(i, j);
+
+    int64_t s = 0;
+    int64_t t = l;
+    do {
+        t = (t + 1) / 2;
+        if (common_prefix(i, i + (s + t) * d) > delta_node) s += t;
+    } while (t > 1);
+    int64_t split = i + s * d + std::min<int64_t>(d, 0);
+
+    uint32_t leaf_base = uint32_t(count - 1);
+    int64_t first = std::min(i, j);
+    int64_t last = std::max(i, j);
+
+    node& nd = nodes[index];
+    nd.left = first == split ? leaf_base + uint32_t(split) : uint32_t(split);
+    nd.right = last == split + 1 ? leaf_base + uint32_t(split + 1) : uint32_t(split + 1);
+    nd.first = uint32_t(first);
+    nd.last = uint32_t(last);
+    nd.item = none;
+    nodes[nd.left].parent = index;
+    nodes[nd.right].parent = index;
+}
+
+template <typename T>
+template <typename F>
+void lbvh<T>::overlaps_of(uint32_t position, F&& f) const {
+    const node& leaf = nodes[count - 1 + position];
+
+    // Depth is bounded by the 64 key bits.
+    std::array<uint32_t, 128> stack;
+    size_t top = 0;
+    stack[top++] = 0;
+
+    while (top) {
+        const node& nd = nodes[stack[--top]];
+        // Only leaves after this one, so each pair is found once.
+        if (nd.last <= position || !details::overlaps(nd.box, leaf.box)) continue;
+
+        if (nd.item != none) {
+            f(std::min(leaf.item, nd.item), std::max(leaf.item, nd.item));
+            continue;
+        }
+        stack[top++] = nd.left;
+        stack[top++] = nd.right;
+    }
+}
+
+template <typename T>
+template <typename F>
+void lbvh<T>::for_each_overlap(F&& f) const {
+    for (uint32_t p = 0; p < count; p++) overlaps_of(p, f);
+}
+
+template <typename T>
+template <typename F>
+void lbvh<T>::for_each_overlap_parallel(F&& f, unsigned workers) const {
+    details::parallel_for(count, [&](size_t begin, size_t end, unsigned w) {
+        for (size_t p = begin; p < end; p++) {
+            overlaps_of(uint32_t(p), [&](uint32_t a, uint32_t b) { f(a, b, w); });
+        }
+    }, workers);
+}
+
+template <typename T>
+template <typename F>
+void lbvh<T>::query(const AABB<T>& box, F&& f) const {
+    if (count == 0) return;
+
+    std::array<uint32_t, 128> stack;
+    size_t top = 0;
+    stack[top++] = 0;
+
+    while (top) {
+        const node& nd = nodes[stack[--top]];
+        if (!details::overlaps(nd.box, box)) continue;
+
+        if (nd.item != none) {
+            f(nd.item);
+            continue;
+        }
+        stack[top++] = nd.left;
+        stack[top++] = nd.right;
+    }
+}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include "tiny_colls/details/vec.h"
+#include "tiny_colls/details/scalar.h"
+
+namespace tiny_colls::details {
+// Coarser convex polygon that fully encloses `polygon`. Repeatedly removes
+// the edge whose neighbours, extended until they meet, add the least area.
+// Stops early when no edge can be removed that way.
+template <typename T>
+std::vector<vec<T>> enclosing_polygon(std::vector<vec<T>> polygon, size_t target) {
+    auto cross = [](const vec<T>& a, const vec<T>& b) { return a.x * b.y - a.y * b.x; };
+
+    T area = T(0);
+    for (size_t i = 0; i < polygon.size(); i++) {
+        area += cross(polygon[i], polygon[(i + 1) % polygon.size()]);
+    }
+    if (area == T(0)) return polygon;
+    if (area < T(0)) std::reverse(polygon.begin(), polygon.end());
+
+    target = std::max<size_t>(target, 3);
+    while (polygon.size() > target) {
+        size_t n = polygon.size();
+        size_t best = n;
+        T best_area = std::numeric_limits<T>::max();
+        vec<T> best_point;
+
+        // Replacing edge i (v_i, v_i+1) by the meeting point of edges i-1 and i+1.
+        for (size_t i = 0; i < n; i++) {
+            const vec<T>& prev = polygon[(i + n - 1) % n];
+            const vec<T>& a = polygon[i];
+            const vec<T>& b = polygon[(i + 1) % n];
+            const vec<T>& next = polygon[(i + 2) % n];
+
+            vec<T> d1 = a - prev;
+            vec<T> d2 = next - b;
+            T denom = cross(d1, d2);
+            if (!(T(0) < denom)) continue; // Neighbours diverge, would not meet outside
+
+            T t = cross(b - a, d2) / denom;
+            if (t < T(0)) continue;
+
+            vec<T> meet = a + d1 * t;
+            T added = details::abs(cross(meet - a, b - a));
+            if (added < best_area) {
+                best_area = added;
+                best = i;
+                best_point = meet;
+            }
+        }
+
+        if (best == n) break;
+
+        polygon[best] = best_point;
+        polygon.erase(polygon.begin() + (best + 1) % n);
+    }
+
+    return polygon;
+}
+}
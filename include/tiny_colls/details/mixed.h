@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <cstdint>
+#include <algorithm>
+#include "tiny_colls/details/sat.h"
+
+namespace tiny_colls::details {
+// SAT on double shapes run in float, relative to the midpoint of the two
+// positions so far-from-origin coordinates keep their precision. Any axis
+// decided by less than a small margin of the shapes' extent makes the test
+// rerun in double; otherwise only the MTV carries float rounding.
+template <typename T>
+bool sat_mixed(
+    std::span<const vec<T>> a_vertices, std::span<const vec<T>> a_axes, const vec<T>& a_position,
+    std::span<const vec<T>> b_vertices, std::span<const vec<T>> b_axes, const vec<T>& b_position,
+    collision<T>& out, uint32_t* feature = nullptr
+) {
+    constexpr size_t max_vertices = 64;
+    auto exact = [&] {
+        return sat(a_vertices, a_axes, a_position, b_vertices, b_axes, b_position, out, feature);
+    };
+    if (a_vertices.size() > max_vertices || b_vertices.size() > max_vertices) return exact();
+    if (a_axes.size() > max_vertices || b_axes.size() > max_vertices) return exact();
+    if (a_axes.empty() && b_axes.empty()) return false;
+
+    // Counted once decided here, a rerun in double counts itself.
+    auto decided = [](bool hit) {
+        TINY_COLLS_STAT(narrowphase_calls, 1);
+        return hit;
+    };
+
+    vec<T> origin = (a_position + b_position) * T(0.5);
+    float extent = 0;
+
+    // Separate x and y arrays, left uninitialized, keep the float loops flat.
+    struct local_points {
+        float x[max_vertices];
+        float y[max_vertices];
+        size_t n;
+    };
+    auto to_local = [&](std::span<const vec<T>> in, local_points& local) {
+        local.n = in.size();
+        for (size_t i = 0; i < in.size(); i++) {
+            local.x[i] = static_cast<float>(in[i].x - origin.x);
+            local.y[i] = static_cast<float>(in[i].y - origin.y);
+            extent = std::max({ extent, std::abs(local.x[i]), std::abs(local.y[i]) });
+        }
+    };
+    auto project_local = [](const local_points& local, float ax, float ay) {
+        TINY_COLLS_STAT(projections, 1);
+        float min = std::numeric_limits<float>::max();
+        float max = std::numeric_limits<float>::lowest();
+        for (size_t i = 0; i < local.n; i++) {
+            float dot = ax * local.x[i] + ay * local.y[i];
+            min = dot < min ? dot : min;
+            max = dot > max ? dot : max;
+        }
+        return proj<float>(min, max);
+    };
+
+    local_points a_local;
+    local_points b_local;
+    to_local(a_vertices, a_local);
+    to_local(b_vertices, b_local);
+
+    const float margin = extent * 1e-5f;
+    bool uncertain = false;
+
+    float smallest_overlap = std::numeric_limits<float>::max();
+    vec<float> overlap_axis(0.0f, 0.0f);
+    uint32_t overlap_feature = 0;
+    uint32_t index = 0;
+
+    auto test = [&](const vec<T>& axis_d) {
+        TINY_COLLS_STAT(axes_tested, 1);
+        vec<float> axis(static_cast<float>(axis_d.x), static_cast<float>(axis_d.y));
+        proj<float> a_proj = project_local(a_local, axis.x, axis.y);
+        proj<float> b_proj = project_local(b_local, axis.x, axis.y);
+
+        float overlap0 = a_proj.max - b_proj.min;
+        float overlap1 = b_proj.max - a_proj.min;
+        float closest = std::min(overlap0, overlap1);
+
+        if (closest < -margin) {
+            TINY_COLLS_STAT(early_outs, 1);
+            return false;
+        }
+        if (closest < margin) uncertain = true;
+
+        float overlap = (overlap0 < overlap1) ? overlap0 : -overlap1;
+        if (std::abs(overlap) < std::abs(smallest_overlap)) {
+            smallest_overlap = overlap;
+            overlap_axis = axis;
+            overlap_feature = index;
+        }
+        index++;
+        return true;
+    };
+
+    for (const auto& axis : a_axes) {
+        if (!test(axis)) return decided(false);
+    }
+    for (const auto& axis : b_axes) {
+        if (!test(axis)) return decided(false);
+    }
+
+    if (uncertain) return exact();
+
+    vec<T> delta = a_position - b_position;
+    if (delta.x * T(overlap_axis.x) + delta.y * T(overlap_axis.y) < T(0)) {
+        overlap_axis = -overlap_axis;
+    }
+
+    out = collision<T> { T(overlap_axis.x), T(overlap_axis.y), T(smallest_overlap) };
+    if (feature) *feature = overlap_feature;
+    return decided(true);
+}
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tiny_colls::details {
+inline unsigned worker_count(unsigned requested = 0) {
+    unsigned n = requested ? requested : std::thread::hardware_concurrency();
+    return std::max(n, 1u);
+}
+
+// Threads started on first use and kept for the life of the process, so a
+// parallel_for per frame or per solver color costs a wake up rather than a
+// thread start. One job runs at a time; a parallel_for issued while the pool
+// is busy, or from inside a job, runs on the calling thread instead.
+class thread_pool {
+public:
+    static thread_pool& instance() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    static bool& inside() {
+        thread_local bool in_job = false;
+        return in_job;
+    }
+
+    // Runs job(w) for w in [0, helpers] with w = helpers on the calling thread.
+    // Returns false without running anything when the pool is taken.
+    template <typename F>
+    bool try_run(unsigned helpers, F& job) {
+        if (inside()) return false;
+        std::unique_lock<std::mutex> owner(busy, std::try_to_lock);
+        if (!owner.owns_lock()) return false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (threads.size() < helpers) {
+                unsigned index = static_cast<unsigned>(threads.size());
+                threads.emplace_back([this, index] { loop(index); });
+            }
+            call = [](void* ctx, unsigned w) { (*static_cast<F*>(ctx))(w); };
+            ctx = &job;
+            active = helpers;
+            pending = helpers;
+            generation++;
+        }
+        wake.notify_all();
+
+        inside() = true;
+        try {
+            job(helpers);
+        } catch (...) {
+            inside() = false;
+            wait();
+            throw;
+        }
+        inside() = false;
+        wait();
+        return true;
+    }
+
+private:
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return pending == 0; });
+    }
+
+    void loop(unsigned index) {
+        inside() = true;
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            if (index >= active) continue;
+
+            lock.unlock();
+            call(ctx, index);
+            lock.lock();
+            if (--pending == 0) done.notify_one();
+        }
+    }
+
+    std::mutex busy;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::vector<std::thread> threads;
+
+    void (*call)(void*, unsigned) = nullptr;
+    void* ctx = nullptr;
+    uint64_t generation = 0;
+    unsigned active = 0;
+    unsigned pending = 0;
+    bool stopping = false;
+};
+
+// f(begin, end, worker) over [0, n) split into one contiguous range per worker,
+// using no more workers than leave each at least grain items. The calling
+// thread runs the last range itself.
+template <typename F>
+void parallel_for(size_t n, F&& f, unsigned workers = 0, size_t grain = 1) {
+    workers = static_cast<unsigned>(std::min<size_t>(worker_count(workers), std::max<size_t>(n / std::max<size_t>(grain, 1), 1)));
+    if (workers == 1) {
+        f(size_t(0), n, 0u);
+        return;
+    }
+
+    size_t chunk = (n + workers - 1) / workers;
+    auto job = [&](unsigned w) {
+        size_t begin = std::min(n, w * chunk);
+        size_t end = w + 1 == workers ? n : std::min(n, begin + chunk);
+        f(begin, end, w);
+    };
+    if (!thread_pool::instance().try_run(workers - 1, job)) f(size_t(0), n, 0u);
+}
+
+// Sorts runs in parallel, then merges neighbouring runs pairwise.
+template <typename It, typename Cmp>
+void parallel_sort(It first, It last, Cmp cmp, unsigned workers = 0) {
+    size_t n = static_cast<size_t>(std::distance(first, last));
+    workers = static_cast<unsigned>(std::min<size_t>(worker_count(workers), std::max<size_t>(n / 4096, 1)));
+    if (workers == 1) {
+        std::sort(first, last, cmp);
+        return;
+    }
+
+    std::vector<size_t> bounds;
+    for (unsigned w = 0; w <= workers; w++) bounds.push_back(n * w / workers);
+
+    parallel_for(workers, [&](size_t begin, size_t end, unsigned) {
+        for (size_t w = begin; w < end; w++) std::sort(first + bounds[w], first + bounds[w + 1], cmp);
+    }, workers);
+
+    for (size_t width = 1; width < workers; width *= 2) {
+        size_t merges = (workers + 2 * width - 1) / (2 * width);
+        parallel_for(merges, [&](size_t begin, size_t end, unsigned) {
+            for (size_t m = begin; m < end; m++) {
+                size_t lo = m * 2 * width;
+                size_t mid = std::min<size_t>(lo + width, workers);
+                size_t hi = std::min<size_t>(lo + 2 * width, workers);
+                if (mid < hi) std::inplace_merge(first + bounds[lo], first + bounds[mid], first + bounds[hi], cmp);
+            }
+        }, static_cast<unsigned>(merges));
+    }
+}
+}
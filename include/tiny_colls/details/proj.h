@@ -1,11 +1,12 @@
 #pragma once
 
 #include <type_traits>
+#include "tiny_colls/details/scalar.h"
 
 namespace tiny_colls::details {
 template <typename T>
 class proj {
-    static_assert(std::is_arithmetic<T>::value, "proj<T>: T must be numeric");
+    static_assert(scalar<T>, "proj<T>: T must be numeric");
 public:
     explicit proj(T min, T max) : min(min), max(max) {}
     T min;
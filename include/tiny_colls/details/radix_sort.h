@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include "tiny_colls/details/parallel.h"
+
+namespace tiny_colls::details {
+// Stable LSD radix sort of keys by their upper 32 bits, 11 bits per pass.
+// Each worker counts and scatters its own contiguous slice, with offsets
+// laid out digit major so the output stays stable.
+inline void parallel_radix_sort(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch, unsigned workers = 0) {
+    constexpr int digit_bits = 11;
+    constexpr size_t buckets = size_t(1) << digit_bits;
+
+    size_t n = keys.size();
+    workers = static_cast<unsigned>(std::min<size_t>(worker_count(workers), std::max<size_t>(n / 16384, 1)));
+    scratch.resize(n);
+
+    std::vector<size_t> offsets(workers * buckets);
+    auto slice = [&](unsigned w) { return std::pair<size_t, size_t>(n * w / workers, n * (w + 1) / workers); };
+
+    for (int shift = 32; shift < 64; shift += digit_bits) {
+        auto digit = [shift](uint64_t k) { return size_t(k >> shift) & (buckets - 1); };
+        std::fill(offsets.begin(), offsets.end(), 0);
+
+        parallel_for(workers, [&](size_t begin, size_t end, unsigned) {
+            for (size_t w = begin; w < end; w++) {
+                auto [lo, hi] = slice(unsigned(w));
+                size_t* count = &offsets[w * buckets];
+                for (size_t i = lo; i < hi; i++) count[digit(keys[i])]++;
+            }
+        }, workers);
+
+        size_t sum = 0;
+        for (size_t d = 0; d < buckets; d++) {
+            for (unsigned w = 0; w < workers; w++) {
+                size_t c = offsets[w * buckets + d];
+                offsets[w * buckets + d] = sum;
+                sum += c;
+            }
+        }
+
+        parallel_for(workers, [&](size_t begin, size_t end, unsigned) {
+            for (size_t w = begin; w < end; w++) {
+                auto [lo, hi] = slice(unsigned(w));
+                size_t* offset = &offsets[w * buckets];
+                for (size_t i = lo; i < hi; i++) scratch[offset[digit(keys[i])]++] = keys[i];
+            }
+        }, workers);
+
+        keys.swap(scratch);
+    }
+}
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <span>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include "tiny_colls/details/scalar.h"
+#include "tiny_colls/details/vec.h"
+#include "tiny_colls/details/proj.h"
+#include "tiny_colls/details/dispatch.h"
+#include "tiny_colls/collision.h"
+#include "tiny_colls/stats.h"
+
+namespace tiny_colls::details {
+template <typename T, size_t E>
+proj<T> project(std::span<const vec<T>, E> vertices, const vec<T>& axis) {
+    TINY_COLLS_STAT(projections, 1);
+    T min = std::numeric_limits<T>::max();
+    T max = std::numeric_limits<T>::lowest();
+
+    for (const auto& v : vertices) {
+        T dot = axis.dot(v);
+
+        if (dot < min)
+            min = dot;
+        if (dot > max)
+            max = dot;
+    }
+
+    return proj<T>(min, max);
+}
+
+// Projects through the SIMD kernels when the shape is large enough to pay for
+// the call. Fixed extents are small inline shapes the compiler unrolls already.
+template <typename T, size_t E>
+proj<T> project_wide(std::span<const vec<T>, E> vertices, const vec<T>& axis) {
+    if constexpr (E == std::dynamic_extent && has_kernels<T>) {
+        if (vertices.size() >= kernel_min_points) {
+            TINY_COLLS_STAT(projections, 1);
+            T min = std::numeric_limits<T>::max();
+            T max = std::numeric_limits<T>::lowest();
+            kernels<T>().project(flat(vertices.data()), vertices.size(), axis.x, axis.y, min, max);
+            return proj<T>(min, max);
+        }
+    }
+    return project(vertices, axis);
+}
+
+template <bool Wide, typename T, size_t VA, size_t AA, size_t VB, size_t AB>
+bool sat_impl(
+    std::span<const vec<T>, VA> a_vertices, std::span<const vec<T>, AA> a_axes, const vec<T>& a_position,
+    std::span<const vec<T>, VB> b_vertices, std::span<const vec<T>, AB> b_axes, const vec<T>& b_position,
+    collision<T>& out, uint32_t* feature
+) {
+    TINY_COLLS_STAT(narrowphase_calls, 1);
+    if (a_axes.empty() && b_axes.empty()) return false; // Nothing to check?
+
+    T smallest_overlap = std::numeric_limits<T>::max();
+    vec<T> overlap_axis(T(0), T(0));
+    uint32_t overlap_feature = 0;
+    uint32_t index = 0;
+
+    auto test = [&](const vec<T>& axis) {
+        TINY_COLLS_STAT(axes_tested, 1);
+        proj<T> a_proj = Wide ? project_wide(a_vertices, axis) : project(a_vertices, axis);
+        proj<T> b_proj = Wide ? project_wide(b_vertices, axis) : project(b_vertices, axis);
+
+        if (a_proj.max < b_proj.min || b_proj.max < a_proj.min) {
+            TINY_COLLS_STAT(early_outs, 1);
+            return false;
+        }
+
+        T overlap0 = a_proj.max - b_proj.min;
+        T overlap1 = b_proj.max - a_proj.min;
+
+        T overlap = (overlap0 < overlap1) ? overlap0 : -overlap1;
+        if (details::abs(overlap) < details::abs(smallest_overlap)) {
+            smallest_overlap = overlap;
+            overlap_axis = axis;
+            overlap_feature = index;
+        }
+        index++;
+        return true;
+    };
+
+    for (const auto& axis : a_axes) {
+        if (!test(axis)) return false;
+    }
+    for (const auto& axis : b_axes) {
+        if (!test(axis)) return false;
+    }
+
+    vec<T> delta = a_position - b_position;
+
+    if (delta.dot(overlap_axis) < T(0)) {
+        overlap_axis = -overlap_axis;
+    }
+
+    out = collision<T> { overlap_axis.x, overlap_axis.y, smallest_overlap };
+    if (feature) *feature = overlap_feature;
+    return true;
+}
+
+// Separating axis test on transformed shapes. Fixed extents let the compiler
+// unroll the loops for inline storage. `out.axis` points from b towards a.
+// `feature` receives the index of the axis giving the MTV, counting a's axes
+// first and b's after.
+template <typename T, size_t VA, size_t AA, size_t VB, size_t AB>
+bool sat(
+    std::span<const vec<T>, VA> a_vertices, std::span<const vec<T>, AA> a_axes, const vec<T>& a_position,
+    std::span<const vec<T>, VB> b_vertices, std::span<const vec<T>, AB> b_axes, const vec<T>& b_position,
+    collision<T>& out, uint32_t* feature = nullptr
+) {
+    // Decided once per pair, a size check per projection costs small shapes
+    // more than the kernels save on large ones.
+    if constexpr (has_kernels<T> && (VA == std::dynamic_extent || VB == std::dynamic_extent)) {
+        if (a_vertices.size() >= kernel_min_points || b_vertices.size() >= kernel_min_points) {
+            return sat_impl<true>(a_vertices, a_axes, a_position, b_vertices, b_axes, b_position, out, feature);
+        }
+    }
+    return sat_impl<false>(a_vertices, a_axes, a_position, b_vertices, b_axes, b_position, out, feature);
+}
+
+// Separating axis test of a transformed shape against an exact circle. Besides
+// the shape's axes only the axis from its nearest vertex to the center can
+// separate them. `out.axis` points from the circle towards the shape.
+template <typename T, size_t VA, size_t AA>
+bool sat_circle(
+    std::span<const vec<T>, VA> vertices, std::span<const vec<T>, AA> axes, const vec<T>& position,
+    const vec<T>& center, T radius, collision<T>& out
+) {
+    TINY_COLLS_STAT(narrowphase_calls, 1);
+    if (vertices.empty()) return false;
+
+    T smallest_overlap = std::numeric_limits<T>::max();
+    vec<T> overlap_axis(T(0), T(0));
+
+    auto test = [&](const vec<T>& axis) {
+        TINY_COLLS_STAT(axes_tested, 1);
+        proj<T> a_proj = project_wide(vertices, axis);
+        T c = axis.dot(center);
+
+        if (a_proj.max < c - radius || c + radius < a_proj.min) {
+            TINY_COLLS_STAT(early_outs, 1);
+            return false;
+        }
+
+        T overlap0 = a_proj.max - (c - radius);
+        T overlap1 = (c + radius) - a_proj.min;
+
+        T overlap = (overlap0 < overlap1) ? overlap0 : -overlap1;
+        if (details::abs(overlap) < details::abs(smallest_overlap)) {
+            smallest_overlap = overlap;
+            overlap_axis = axis;
+        }
+        return true;
+    };
+
+    for (const auto& axis : axes) {
+        if (!test(axis)) return false;
+    }
+
+    const vec<T>* nearest = &vertices[0];
+    for (const auto& v : vertices) {
+        if ((v - center).dot(v - center) < (*nearest - center).dot(*nearest - center)) nearest = &v;
+    }
+    vec<T> to_center = center - *nearest;
+    if (to_center.x != T(0) || to_center.y != T(0)) {
+        if (!test(to_center.normalize())) return false;
+    }
+
+    vec<T> delta = position - center;
+
+    if (delta.dot(overlap_axis) < T(0)) {
+        overlap_axis = -overlap_axis;
+    }
+
+    out = collision<T> { overlap_axis.x, overlap_axis.y, smallest_overlap };
+    return true;
+}
+
+template <typename T, size_t VE, size_t AE>
+bool contains_point(std::span<const vec<T>, VE> vertices, std::span<const vec<T>, AE> axes, const vec<T>& point) {
+    for (const auto& axis : axes) {
+        proj<T> this_proj = project_wide(vertices, axis);
+        T point_d = axis.dot(point);
+
+        if (this_proj.max < point_d || point_d < this_proj.min) {
+            return false;
+        }
+    }
+
+    return true;
+}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+namespace tiny_colls::details {
+template <typename T>
+struct is_fixed_point : std::false_type {};
+
+// Coordinate types the library accepts: floating point, or fixed point types
+// that opt in through is_fixed_point and provide sin, cos, sqrt, abs and floor
+// in their own namespace.
+template <typename T>
+concept scalar = std::is_floating_point_v<T> || is_fixed_point<T>::value;
+
+// Unqualified calls let fixed point types supply deterministic versions
+// through argument dependent lookup.
+template <scalar T>
+T sin(T x) {
+    using std::sin;
+    return sin(x);
+}
+
+template <scalar T>
+T cos(T x) {
+    using std::cos;
+    return cos(x);
+}
+
+template <scalar T>
+T sqrt(T x) {
+    using std::sqrt;
+    return sqrt(x);
+}
+
+template <scalar T>
+T abs(T x) {
+    using std::abs;
+    return abs(x);
+}
+
+template <scalar T>
+T floor(T x) {
+    using std::floor;
+    return floor(x);
+}
+
+template <scalar T>
+bool isfinite(T x) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::isfinite(x);
+    } else {
+        return true;
+    }
+}
+
+template <scalar T>
+constexpr T pi() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::numbers::pi_v<T>;
+    } else {
+        return T(std::numbers::pi);
+    }
+}
+
+// Largest edge component below which an edge gives no axis. Linear rather
+// than squared, fixed point squares of long edges overflow.
+template <scalar T>
+constexpr T edge_epsilon() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return T(3e-4);
+    } else {
+        return std::numeric_limits<T>::epsilon();
+    }
+}
+
+// Largest magnitude that still converts to int32_t.
+template <scalar T>
+constexpr T int_limit() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return T(1 << 30);
+    } else {
+        constexpr T max = std::numeric_limits<T>::max();
+        return static_cast<double>(max) < double(1 << 30) ? max : T(1 << 30);
+    }
+}
+}
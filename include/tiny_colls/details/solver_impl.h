@@ -0,0 +1,142 @@
+#pragma once
+
+#include <bit>
+#include <algorithm>
+#include "tiny_colls/details/parallel.h"
+
+namespace tiny_colls {
+template <typename T>
+overlap_solver<T>::overlap_solver(const solver_options<T>& options) : options(options) {}
+
+template <typename T>
+void overlap_solver<T>::solve(world<T>& w, std::span<const contact<T>> contacts) {
+    solve(w, contacts, [](collider_handle) { return T(1); });
+}
+
+template <typename T>
+template <typename F>
+void overlap_solver<T>::solve(world<T>& w, std::span<const contact<T>> contacts, F&& inverse_mass) {
+    bodies.clear();
+    inv_mass.clear();
+    color_of.clear();
+    color_start.fill(0);
+    colors = 0;
+
+    uint32_t max_index = 0;
+    for (const auto& c : contacts) max_index = std::max({ max_index, c.a.index, c.b.index });
+    body_of.assign(contacts.empty() ? 0 : max_index + 1, none);
+
+    auto valid = [&](const contact<T>& c) { return w.contains(c.a) && w.contains(c.b); };
+    auto body = [&](collider_handle h) {
+        uint32_t& b = body_of[h.index];
+        if (b == none) {
+            b = static_cast<uint32_t>(bodies.size());
+            bodies.push_back(h);
+            inv_mass.push_back(inverse_mass(h));
+        }
+        return b;
+    };
+
+    for (const auto& c : contacts) {
+        if (!valid(c)) continue;
+        body(c.a);
+        body(c.b);
+    }
+
+    // Greedy coloring: each contact takes the lowest color neither body uses.
+    used_colors.assign(bodies.size(), 0);
+    for (const auto& c : contacts) {
+        if (!valid(c)) continue;
+        uint32_t a = body_of[c.a.index];
+        uint32_t b = body_of[c.b.index];
+
+        uint64_t free = ~(used_colors[a] | used_colors[b]);
+        uint32_t color = free ? static_cast<uint32_t>(std::countr_zero(free)) : max_colors;
+        if (color < max_colors) {
+            used_colors[a] |= uint64_t(1) << color;
+            used_colors[b] |= uint64_t(1) << color;
+        }
+        color_of.push_back(color);
+        color_start[color + 1]++;
+    }
+    for (size_t i = 1; i < color_start.size(); i++) {
+        if (color_start[i]) colors++;
+        color_start[i] += color_start[i - 1];
+    }
+
+    size_t n = color_of.size();
+    body_a.resize(n);
+    body_b.resize(n);
+    nx.resize(n);
+    ny.resize(n);
+    depth.resize(n);
+    share_a.resize(n);
+    share_b.resize(n);
+
+    auto cursor = color_start;
+    size_t k = 0;
+    for (const auto& c : contacts) {
+        if (!valid(c)) continue;
+        size_t slot = cursor[color_of[k++]]++;
+
+        // The MTV axis points from b towards a.
+        body_a[slot] = body_of[c.a.index];
+        body_b[slot] = body_of[c.b.index];
+        nx[slot] = c.coll.axis_x;
+        ny[slot] = c.coll.axis_y;
+        depth[slot] = details::abs(c.coll.overlap);
+
+        T ma = inv_mass[body_a[slot]];
+        T mb = inv_mass[body_b[slot]];
+        T total = ma + mb;
+        share_a[slot] = total == T(0) ? T(0) : ma / total;
+        share_b[slot] = total == T(0) ? T(0) : mb / total;
+    }
+
+    dx.assign(bodies.size(), T(0));
+    dy.assign(bodies.size(), T(0));
+
+    for (uint32_t it = 0; it < options.iterations; it++) {
+        for (uint32_t color = 0; color <= max_colors; color++) {
+            solve_batch(color_start[color], color_start[color + 1], color < max_colors ? options.workers : 1);
+        }
+    }
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        if (dx[i] == T(0) && dy[i] == T(0)) continue;
+
+        collider<T>& c = w.get(bodies[i]);
+        point<T> p = c.get_position();
+        c.set_position(p.x + dx[i], p.y + dy[i]);
+    }
+}
+
+template <typename T>
+size_t overlap_solver<T>::color_count() const {
+    return colors;
+}
+
+template <typename T>
+void overlap_solver<T>::solve_batch(size_t begin, size_t end, unsigned workers) {
+    // Small colors are not worth waking threads for.
+    unsigned threads = end - begin >= 4096 ? workers : 1;
+
+    details::parallel_for(end - begin, [&](size_t lo, size_t hi, unsigned) {
+        for (size_t k = begin + lo; k < begin + hi; k++) {
+            uint32_t a = body_a[k];
+            uint32_t b = body_b[k];
+
+            // Penetration left after the corrections made so far.
+            T remaining = depth[k] - nx[k] * (dx[a] - dx[b]) - ny[k] * (dy[a] - dy[b]) - options.slop;
+            if (!(remaining > T(0))) continue;
+
+            T push_a = remaining * share_a[k];
+            T push_b = remaining * share_b[k];
+            dx[a] += nx[k] * push_a;
+            dy[a] += ny[k] * push_a;
+            dx[b] -= nx[k] * push_b;
+            dy[b] -= ny[k] * push_b;
+        }
+    }, threads);
+}
+}
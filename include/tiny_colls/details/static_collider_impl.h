@@ -0,0 +1,177 @@
+#pragma once
+
+#include <limits>
+#include "tiny_colls/details/collider_access.h"
+#include "tiny_colls/details/tessellation.h"
+
+namespace tiny_colls {
+template <typename T, size_t N>
+static_collider<T, N>::static_collider(const std::array<point<T>, N>& points) {
+    for (size_t i = 0; i < N; i++) {
+        vertices[i] = vec(points[i].x, points[i].y);
+    }
+}
+
+template <typename T, size_t N>
+static_collider<T, N>& static_collider<T, N>::set_position(T x, T y) {
+    position = vec(x, y);
+    dirty = true;
+    return *this;
+}
+
+template <typename T, size_t N>
+static_collider<T, N>& static_collider<T, N>::set_rotation(T rotation) {
+    this->rotation = rotation;
+    dirty = true;
+    return *this;
+}
+
+template <typename T, size_t N>
+std::array<point<T>, N> static_collider<T, N>::get_shape() const {
+    ensure_transformed();
+
+    std::array<point<T>, N> shape;
+    for (size_t i = 0; i < N; i++) {
+        shape[i] = { t_vertices[i].x, t_vertices[i].y };
+    }
+    return shape;
+}
+
+template <typename T, size_t N>
+AABB<T> static_collider<T, N>::get_bounding_box() const {
+    ensure_transformed();
+    return t_aabb;
+}
+
+template <typename T, size_t N>
+bool static_collider<T, N>::is_point_in(T x, T y) {
+    ensure_transformed();
+    return details::contains_point(std::span<const vec, N>(t_vertices), axes(), vec(x, y));
+}
+
+template <typename T, size_t N>
+template <size_t M>
+bool static_collider<T, N>::is_colliding_with(const static_collider<T, M>& other, collision<T>& out) {
+    if (static_cast<const void*>(this) == static_cast<const void*>(&other)) return false;
+
+    ensure_transformed();
+    other.ensure_transformed();
+
+    std::span<const vec, N> a_vertices(t_vertices);
+    std::span<const vec, M> b_vertices(other.t_vertices);
+
+    if (axis_count == N && other.axis_count == M) {
+        return details::sat(
+            a_vertices, std::span<const vec, N>(t_axes), position,
+            b_vertices, std::span<const vec, M>(other.t_axes), other.position,
+            out
+        );
+    }
+
+    return details::sat(a_vertices, axes(), position, b_vertices, other.axes(), other.position, out);
+}
+
+template <typename T, size_t N>
+bool static_collider<T, N>::is_colliding_with(const collider<T>& other, collision<T>& out) {
+    ensure_transformed();
+    auto& o = details::collider_access::transformed(other);
+
+    return details::sat(
+        std::span<const vec, N>(t_vertices), axes(), position,
+        std::span<const vec>(o.t_vertices), std::span<const vec>(o.t_axes), o.position,
+        out
+    );
+}
+
+template <typename T, size_t N>
+static_collider<T, N> static_collider<T, N>::rect(T width, T height) requires (N == 4) {
+    T half_width = width / T(2);
+    T half_height = height / T(2);
+
+    return static_collider(std::array<point<T>, N> {
+        point<T> { -half_width, -half_height }, point<T> { half_width, -half_height },
+        point<T> { half_width, half_height }, point<T> { -half_width, half_height },
+    });
+}
+
+template <typename T, size_t N>
+static_collider<T, N> static_collider<T, N>::line(T length) requires (N == 4) {
+    return rect(T(0), length);
+}
+
+template <typename T, size_t N>
+static_collider<T, N> static_collider<T, N>::poly(T width, T height) {
+    static_assert(N >= 3, "static_collider<T, N>::poly: N must be 3 or higher");
+
+    constexpr auto& unit = details::unit_polygon<T, N>;
+    T half_width = width / T(2);
+    T half_height = height / T(2);
+
+    std::array<point<T>, N> points;
+    for (size_t i = 0; i < N; i++) {
+        points[i] = { half_width * unit[i].x, half_height * unit[i].y };
+    }
+
+    return static_collider(points);
+}
+
+template <typename T, size_t N>
+static_collider<T, N> static_collider<T, N>::ellipse(T a, T b) {
+    return poly(a * T(2), b * T(2));
+}
+
+template <typename T, size_t N>
+static_collider<T, N> static_collider<T, N>::circle(T radius) {
+    return ellipse(radius, radius);
+}
+
+template <typename T, size_t N>
+void static_collider<T, N>::ensure_transformed() const {
+    if (!dirty) return;
+    TINY_COLLS_STAT(transforms, 1);
+
+    T c = details::cos(rotation);
+    T s = details::sin(rotation);
+
+    for (size_t i = 0; i < N; i++) {
+        const vec& v = vertices[i];
+        t_vertices[i] = vec(c * v.x - s * v.y + position.x, s * v.x + c * v.y + position.y);
+    }
+
+    axis_count = 0;
+    for (size_t i = 0; i < N; i++) {
+        vec edge = t_vertices[(i + 1) % N] - t_vertices[i];
+        if (edge.largest() < details::edge_epsilon<T>())
+            continue;
+
+        t_axes[axis_count++] = edge.perp().normalize();
+    }
+
+    // Degenerate edges are padded with a repeated axis so the full-size loop
+    // stays valid; testing an axis twice does not change the result.
+    for (size_t i = axis_count; i < N && axis_count > 0; i++) {
+        t_axes[i] = t_axes[0];
+    }
+    if (axis_count > 0) axis_count = N;
+
+    T left = std::numeric_limits<T>::max();
+    T right = std::numeric_limits<T>::lowest();
+    T bottom = std::numeric_limits<T>::max();
+    T top = std::numeric_limits<T>::lowest();
+
+    for (const auto& v : t_vertices) {
+        left = std::min(left, v.x);
+        right = std::max(right, v.x);
+        bottom = std::min(bottom, v.y);
+        top = std::max(top, v.y);
+    }
+
+    t_aabb = AABB<T> { top, bottom, left, right };
+    dirty = false;
+}
+
+template <typename T, size_t N>
+std::span<const typename static_collider<T, N>::vec> static_collider<T, N>::axes() const {
+    return std::span<const vec>(t_axes.data(), axis_count);
+}
+}
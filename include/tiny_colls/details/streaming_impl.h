@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+#include "tiny_colls/details/io.h"
+
+namespace tiny_colls {
+template <typename T>
+chunk_streamer<T>::chunk_streamer(world<T>& w, T chunk_size, loader load)
+    : w(w), chunk_size(chunk_size), load_chunk(std::move(load)) {
+    if (!(chunk_size > T(0))) {
+        throw std::invalid_argument("Chunk size must be positive.");
+    }
+    if (!load_chunk) {
+        throw std::invalid_argument("Chunk streamer needs a loader.");
+    }
+    worker = std::thread([this] { run(); });
+}
+
+template <typename T>
+chunk_streamer<T>::~chunk_streamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+}
+
+template <typename T>
+void chunk_streamer<T>::load(chunk_coord c) {
+    uint64_t key = key_of(c);
+    if (chunks.contains(key)) return;
+
+    chunk& ch = chunks[key];
+    ch.ticket = ++next_ticket;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(job { c, ch.ticket });
+    }
+    wake.notify_one();
+}
+
+template <typename T>
+void chunk_streamer<T>::unload(chunk_coord c) {
+    auto it = chunks.find(key_of(c));
+    if (it == chunks.end()) return;
+
+    chunk& ch = it->second;
+    if (ch.state == chunk_state::loading) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::erase_if(jobs, [&](const job& j) { return j.ticket == ch.ticket; });
+    }
+
+    for (auto h : ch.handles) {
+        if (w.contains(h)) w.remove(h);
+    }
+
+    std::erase(splicing, c);
+    chunks.erase(it);
+}
+
+template <typename T>
+void chunk_streamer<T>::set_focus(T x, T y, int radius) {
+    int32_t cx = static_cast<int32_t>(details::floor(x / chunk_size));
+    int32_t cy = static_cast<int32_t>(details::floor(y / chunk_size));
+
+    auto in_focus = [&](chunk_coord c) {
+        return std::abs(c.x - cx) <= radius && std::abs(c.y - cy) <= radius;
+    };
+
+    std::vector<chunk_coord> stale;
+    for (auto& [key, ch] : chunks) {
+        chunk_coord c { int32_t(key >> 32), int32_t(uint32_t(key)) };
+        if (!in_focus(c)) stale.push_back(c);
+    }
+    for (auto c : stale) unload(c);
+
+    for (int32_t dx = -radius; dx <= radius; dx++) {
+        for (int32_t dy = -radius; dy <= radius; dy++) {
+            load(chunk_coord { cx + dx, cy + dy });
+        }
+    }
+}
+
+template <typename T>
+size_t chunk_streamer<T>::update(size_t max_insertions) {
+    std::vector<result> done;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done.swap(results);
+    }
+
+    std::exception_ptr error;
+    for (auto& r : done) {
+        auto it = chunks.find(key_of(r.coord));
+        if (it == chunks.end() || it->second.ticket != r.ticket) continue; // Unloaded meanwhile
+
+        if (r.error) {
+            chunks.erase(it);
+            if (!error) error = r.error;
+            continue;
+        }
+
+        it->second.built = std::move(r.built);
+        it->second.state = chunk_state::splicing;
+        splicing.push_back(r.coord);
+    }
+
+    size_t inserted = 0;
+    while (!splicing.empty() && inserted < max_insertions) {
+        chunk& ch = chunks.at(key_of(splicing.front()));
+
+        while (ch.next < ch.built.size() && inserted < max_insertions) {
+            ch.handles.push_back(w.add(std::move(ch.built[ch.next++])));
+            inserted++;
+        }
+
+        if (ch.next == ch.built.size()) {
+            ch.built = std::vector<collider<T>>();
+            ch.state = chunk_state::resident;
+            splicing.pop_front();
+        }
+    }
+
+    if (error) std::rethrow_exception(error);
+    return inserted;
+}
+
+template <typename T>
+bool chunk_streamer<T>::is_resident(chunk_coord c) const {
+    auto it = chunks.find(key_of(c));
+    return it != chunks.end() && it->second.state == chunk_state::resident;
+}
+
+template <typename T>
+size_t chunk_streamer<T>::pending() const {
+    return std::count_if(chunks.begin(), chunks.end(), [](const auto& kv) {
+        return kv.second.state != chunk_state::resident;
+    });
+}
+
+template <typename T>
+const std::vector<collider_handle>& chunk_streamer<T>::handles(chunk_coord c) const {
+    auto it = chunks.find(key_of(c));
+    if (it == chunks.end()) {
+        throw std::logic_error("Chunk is not loaded.");
+    }
+    return it->second.handles;
+}
+
+template <typename T>
+uint64_t chunk_streamer<T>::key_of(chunk_coord c) {
+    return (uint64_t(uint32_t(c.x)) << 32) | uint64_t(uint32_t(c.y));
+}
+
+template <typename T>
+void chunk_streamer<T>::run() {
+    for (;;) {
+        job j;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (stopping) return;
+
+            j = jobs.front();
+            jobs.pop_front();
+        }
+
+        result r { j.coord, j.ticket, {}, nullptr };
+        try {
+            auto records = load_chunk(j.coord);
+            r.built.reserve(records.size());
+            for (const auto& data : records) {
+                // Transforming here keeps the splice on the frame thread cheap.
+                auto c = collider<T>::raw(data);
+                c.get_bounding_box();
+                r.built.push_back(std::move(c));
+            }
+        } catch (...) {
+            r.built.clear();
+            r.error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        results.push_back(std::move(r));
+    }
+}
+
+template <typename T>
+void write_chunk(std::ostream& out, const std::vector<collider<T>>& colliders) {
+    uint32_t count = static_cast<uint32_t>(colliders.size());
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+    std::vector<T> data;
+    for (const auto& c : colliders) {
+        data.resize(c.get_raw(std::span<T>()));
+        c.get_raw(data);
+        uint32_t len = static_cast<uint32_t>(data.size());
+        out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+        out.write(reinterpret_cast<const char*>(data.data()), sizeof(T) * len);
+    }
+}
+
+template <typename T>
+std::vector<std::vector<T>> read_chunk(std::istream& in) {
+    uint32_t count = 0;
+    if (!in.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+        throw std::invalid_argument("Truncated chunk data.");
+    }
+
+    // Counts come from the stream, so records are only added as they are read.
+    std::vector<std::vector<T>> records;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t len = 0;
+        if (!in.read(reinterpret_cast<char*>(&len), sizeof(len))) {
+            throw std::invalid_argument("Truncated chunk data.");
+        }
+
+        std::vector<T> data;
+        if (!details::read_values(in, data, len)) {
+            throw std::invalid_argument("Truncated chunk data.");
+        }
+        records.push_back(std::move(data));
+    }
+
+    return records;
+}
+}
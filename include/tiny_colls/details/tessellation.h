@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <span>
+#include <cmath>
+#include <numbers>
+#include "tiny_colls/point.h"
+#include "tiny_colls/details/vec.h"
+#include "tiny_colls/details/scalar.h"
+
+namespace tiny_colls::details {
+// Taylor series evaluated in double so unit shapes can be built at compile
+// time, std::sin and std::cos are not constexpr in C++20.
+constexpr double const_sin(double x) {
+    constexpr double pi = std::numbers::pi_v<double>;
+    while (x > pi) x -= 2 * pi;
+    while (x < -pi) x += 2 * pi;
+
+    double term = x;
+    double sum = x;
+    for (int k = 1; k < 24; k++) {
+        term *= -x * x / double((2 * k) * (2 * k + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double const_cos(double x) {
+    constexpr double pi = std::numbers::pi_v<double>;
+    while (x > pi) x -= 2 * pi;
+    while (x < -pi) x += 2 * pi;
+
+    double term = 1;
+    double sum = 1;
+    for (int k = 1; k < 24; k++) {
+        term *= -x * x / double((2 * k - 1) * (2 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+// Vertex i of the unit N-gon sits at angle 2 * pi * i / N.
+template <typename T, size_t N>
+constexpr std::array<point<T>, N> make_unit_polygon() {
+    std::array<point<T>, N> out {};
+    for (size_t i = 0; i < N; i++) {
+        double angle = 2 * std::numbers::pi_v<double> * double(i) / double(N);
+        out[i] = point<T> { T(const_cos(angle)), T(const_sin(angle)) };
+    }
+    return out;
+}
+
+// Normal of edge i -> i + 1 of the unit N-gon, pointing inward like the
+// edge.perp() axes runtime shapes get, so overlaps keep the same sign.
+template <typename T, size_t N>
+constexpr std::array<point<T>, N> make_unit_normals() {
+    std::array<point<T>, N> out {};
+    for (size_t i = 0; i < N; i++) {
+        double angle = std::numbers::pi_v<double> * double(2 * i + 1) / double(N);
+        out[i] = point<T> { T(-const_cos(angle)), T(-const_sin(angle)) };
+    }
+    return out;
+}
+
+template <typename T, size_t N>
+inline constexpr std::array<point<T>, N> unit_polygon = make_unit_polygon<T, N>();
+
+template <typename T, size_t N>
+inline constexpr std::array<point<T>, N> unit_normals = make_unit_normals<T, N>();
+
+template <typename T>
+std::vector<point<T>> make_unit_polygon(int n) {
+    T step = T(2) * pi<T>() / T(n);
+
+    std::vector<point<T>> out;
+    out.reserve(n);
+    for (int i = 0; i < n; i++) {
+        out.push_back({ details::cos(step * T(i)), details::sin(step * T(i)) });
+    }
+    return out;
+}
+
+template <typename T>
+std::vector<vec<T>> scaled(std::span<const point<T>> unit, T sx, T sy) {
+    std::vector<vec<T>> vertices;
+    vertices.reserve(unit.size());
+
+    for (const auto& p : unit) {
+        vertices.push_back(vec<T>(sx * p.x, sy * p.y));
+    }
+    return vertices;
+}
+
+// Bottom half of the unit polygon around the lower cap center, top half
+// around the upper.
+template <typename T>
+std::vector<vec<T>> capsule_vertices(std::span<const point<T>> unit, T width, T height) {
+    T radius = width / T(2);
+    size_t half = unit.size() / 2;
+
+    std::vector<vec<T>> vertices;
+    vertices.reserve(unit.size());
+
+    vec<T> cursor = vec<T>(T(0), radius - height / T(2));
+    for (size_t i = 0; i < unit.size(); i++) {
+        if (i == half) cursor = vec<T>(T(0), height / T(2) - radius);
+        vertices.push_back(cursor + vec<T>(radius * unit[i].x, radius * unit[i].y));
+    }
+    return vertices;
+}
+
+// Quarter i of the unit polygon is placed around corner i, counter clockwise
+// from the top right.
+template <typename T>
+std::vector<vec<T>> rounded_rect_vertices(std::span<const point<T>> unit, T width, T height, T roundness) {
+    T half_width = width / T(2);
+    T half_height = height / T(2);
+
+    T radius_x = roundness * half_width;
+    T radius_y = roundness * half_height;
+
+    const std::array<vec<T>, 4> corners = {
+        vec<T>(half_width - radius_x, half_height - radius_y),
+        vec<T>(-half_width + radius_x, half_height - radius_y),
+        vec<T>(-half_width + radius_x, -half_height + radius_y),
+        vec<T>(half_width - radius_x, -half_height + radius_y),
+    };
+
+    size_t corner_n = unit.size() / 4;
+
+    std::vector<vec<T>> vertices;
+    vertices.reserve(unit.size());
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < corner_n; j++) {
+            const auto& p = unit[i * corner_n + j];
+            vertices.push_back(corners[i] + vec<T>(radius_x * p.x, radius_y * p.y));
+        }
+    }
+    return vertices;
+}
+}
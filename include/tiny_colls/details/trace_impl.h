@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include "tiny_colls/details/io.h"
+
+namespace tiny_colls {
+namespace details {
+inline constexpr char trace_magic[4] = { 'T', 'C', 'T', 'R' };
+inline constexpr uint32_t trace_version = 1;
+
+template <typename V>
+V read_trace(std::istream& in) {
+    V v;
+    if (!in.read(reinterpret_cast<char*>(&v), sizeof(V))) {
+        throw std::invalid_argument("Truncated trace data.");
+    }
+    return v;
+}
+}
+
+inline double replay_result::percentile(double p) const {
+    if (frame_ms.empty()) return 0;
+
+    std::vector<double> sorted = frame_ms;
+    std::sort(sorted.begin(), sorted.end());
+    double rank = std::clamp(p, 0.0, 100.0) / 100.0 * double(sorted.size() - 1);
+    return sorted[size_t(rank + 0.5)];
+}
+
+template <typename T>
+trace_recorder<T>::trace_recorder(world<T>& w, std::ostream& out) : w(w), out(out) {
+    out.write(details::trace_magic, sizeof(details::trace_magic));
+    put(details::trace_version);
+    put(uint32_t(sizeof(T)));
+}
+
+template <typename T>
+collider_handle trace_recorder<T>::add(collider<T> c) {
+    std::vector<T> data = c.get_raw();
+    collider_handle h = w.add(std::move(c));
+
+    event(trace_event::add);
+    put(h.index);
+    put(uint32_t(data.size()));
+    out.write(reinterpret_cast<const char*>(data.data()), sizeof(T) * data.size());
+    return h;
+}
+
+template <typename T>
+void trace_recorder<T>::remove(collider_handle h) {
+    w.remove(h);
+    event(trace_event::remove);
+    put(h.index);
+}
+
+template <typename T>
+void trace_recorder<T>::set_position(collider_handle h, T x, T y) {
+    w.get(h).set_position(x, y);
+    event(trace_event::set_position);
+    put(h.index);
+    put(x);
+    put(y);
+}
+
+template <typename T>
+void trace_recorder<T>::set_rotation(collider_handle h, T rotation) {
+    w.get(h).set_rotation(rotation);
+    event(trace_event::set_rotation);
+    put(h.index);
+    put(rotation);
+}
+
+template <typename T>
+void trace_recorder<T>::update() {
+    w.update();
+    event(trace_event::update);
+}
+
+template <typename T>
+template <typename F>
+void trace_recorder<T>::query_aabb(const AABB<T>& box, F&& f) {
+    w.query_aabb(box, f);
+    event(trace_event::query_aabb);
+    put(box.top);
+    put(box.bottom);
+    put(box.left);
+    put(box.right);
+}
+
+template <typename T>
+template <typename F>
+void trace_recorder<T>::query_circle(T x, T y, T radius, F&& f) {
+    w.query_circle(x, y, radius, f);
+    event(trace_event::query_circle);
+    put(x);
+    put(y);
+    put(radius);
+}
+
+template <typename T>
+template <typename F>
+void trace_recorder<T>::for_each_contact(F&& f) {
+    w.for_each_contact(f);
+    event(trace_event::contacts);
+}
+
+template <typename T>
+void trace_recorder<T>::end_frame() {
+    event(trace_event::end_frame);
+}
+
+template <typename T>
+void trace_recorder<T>::event(trace_event e) {
+    put(static_cast<uint8_t>(e));
+}
+
+template <typename T>
+template <typename V>
+void trace_recorder<T>::put(const V& v) {
+    out.write(reinterpret_cast<const char*>(&v), sizeof(V));
+}
+
+template <typename T>
+replay_result replay_trace(std::istream& in, const replay_options<T>& options) {
+    char magic[4];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, details::trace_magic, sizeof(magic)) != 0) {
+        throw std::invalid_argument("Not a trace.");
+    }
+    if (details::read_trace<uint32_t>(in) != details::trace_version) {
+        throw std::invalid_argument("Unsupported trace version.");
+    }
+    if (details::read_trace<uint32_t>(in) != sizeof(T)) {
+        throw std::invalid_argument("Trace was recorded with another coordinate type.");
+    }
+
+    world<T> w(options.cell_size);
+    w.set_pair_cache(options.pair_cache);
+    if constexpr (std::is_floating_point_v<T>) {
+        w.set_mixed_precision(options.mixed_precision);
+    }
+
+    // Trace ids to this world's handles.
+    std::vector<collider_handle> handles;
+    auto handle = [&](uint32_t id) -> collider_handle {
+        if (id >= handles.size() || !w.contains(handles[id])) {
+            throw std::invalid_argument("Trace refers to an unknown collider.");
+        }
+        return handles[id];
+    };
+
+    replay_result result;
+    auto count_hit = [&](collider_handle, const collision<T>&) { result.query_hits++; };
+
+    lbvh<T> tree;
+    std::vector<AABB<T>> boxes;
+    std::vector<collider_handle> live;
+    auto contacts = [&] {
+        if (options.broadphase == replay_broadphase::grid) {
+            w.for_each_contact([&](const contact<T>&) { result.contacts++; });
+            return;
+        }
+
+        boxes.clear();
+        live.clear();
+        for (auto h : handles) {
+            if (!w.contains(h)) continue;
+            live.push_back(h);
+            boxes.push_back(w.get(h).get_bounding_box());
+        }
+        tree.build(boxes, options.workers);
+        tree.for_each_overlap([&](uint32_t a, uint32_t b) {
+            collision<T> c;
+            bool hit;
+            if constexpr (std::is_floating_point_v<T>) {
+                hit = options.mixed_precision
+                    ? w.get(live[a]).is_colliding_with_mixed(w.get(live[b]), c)
+                    : w.get(live[a]).is_colliding_with(w.get(live[b]), c);
+            } else {
+                hit = w.get(live[a]).is_colliding_with(w.get(live[b]), c);
+            }
+            result.contacts += hit;
+        });
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    bool frame_open = false;
+    for (;;) {
+        uint8_t e;
+        if (!in.read(reinterpret_cast<char*>(&e), 1)) break;
+        frame_open = static_cast<trace_event>(e) != trace_event::end_frame;
+
+        switch (static_cast<trace_event>(e)) {
+        case trace_event::add: {
+            uint32_t id = details::read_trace<uint32_t>(in);
+            uint32_t n = details::read_trace<uint32_t>(in);
+            std::vector<T> data;
+            if (!details::read_values(in, data, n)) {
+                throw std::invalid_argument("Truncated trace data.");
+            }
+            if (id >= handles.size()) handles.resize(id + 1);
+            handles[id] = w.add(collider<T>::raw(data));
+            break;
+        }
+        case trace_event::remove:
+            w.remove(handle(details::read_trace<uint32_t>(in)));
+            break;
+        case trace_event::set_position: {
+            collider_handle h = handle(details::read_trace<uint32_t>(in));
+            T x = details::read_trace<T>(in);
+            T y = details::read_trace<T>(in);
+            w.get(h).set_position(x, y);
+            break;
+        }
+        case trace_event::set_rotation: {
+            collider_handle h = handle(details::read_trace<uint32_t>(in));
+            w.get(h).set_rotation(details::read_trace<T>(in));
+            break;
+        }
+        case trace_event::update:
+            // Region queries still go through the grid with the LBVH.
+            w.update(options.workers);
+            break;
+        case trace_event::query_aabb: {
+            AABB<T> box;
+            box.top = details::read_trace<T>(in);
+            box.bottom = details::read_trace<T>(in);
+            box.left = details::read_trace<T>(in);
+            box.right = details::read_trace<T>(in);
+            w.query_aabb(box, count_hit);
+            break;
+        }
+        case trace_event::query_circle: {
+            T x = details::read_trace<T>(in);
+            T y = details::read_trace<T>(in);
+            T radius = details::read_trace<T>(in);
+            w.query_circle(x, y, radius, count_hit);
+            break;
+        }
+        case trace_event::contacts:
+            contacts();
+            break;
+        case trace_event::end_frame: {
+            auto end = std::chrono::steady_clock::now();
+            result.frame_ms.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            start = std::chrono::steady_clock::now();
+            break;
+        }
+        default:
+            throw std::invalid_argument("Unknown trace event.");
+        }
+    }
+
+    // Recorders end every frame, a trace stopping inside one was cut short.
+    if (frame_open) {
+        throw std::invalid_argument("Truncated trace data.");
+    }
+    return result;
+}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include "tiny_colls/aabb.h"
+#include "tiny_colls/details/vec.h"
+#include "tiny_colls/details/dispatch.h"
+
+namespace tiny_colls::details {
+// Applies the 2x2 matrix m and offset o to n points. Plain non aliasing
+// arrays and no calls in the loop let the compiler vectorize it.
+template <typename T>
+void transform_points(
+    const vec<T>* __restrict in, vec<T>* __restrict out, size_t n,
+    T m00, T m01, T m10, T m11, T ox, T oy
+) {
+    if constexpr (has_kernels<T>) {
+        if (n >= kernel_min_points) {
+            const T m[6] = { m00, m01, m10, m11, ox, oy };
+            kernels<T>().transform(flat(in), flat(out), n, m);
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        T x = in[i].x;
+        T y = in[i].y;
+        out[i].x = m00 * x + m01 * y + ox;
+        out[i].y = m10 * x + m11 * y + oy;
+    }
+}
+
+// Same as transform_points, also returning the bounding box of the output so
+// the points are only read once.
+template <typename T>
+AABB<T> transform_points_bounded(
+    const vec<T>* __restrict in, vec<T>* __restrict out, size_t n,
+    T m00, T m01, T m10, T m11, T ox, T oy
+) {
+    T min_x = std::numeric_limits<T>::max();
+    T min_y = std::numeric_limits<T>::max();
+    T max_x = std::numeric_limits<T>::lowest();
+    T max_y = std::numeric_limits<T>::lowest();
+
+    if constexpr (has_kernels<T>) {
+        if (n >= kernel_min_points) {
+            const T m[6] = { m00, m01, m10, m11, ox, oy };
+            T box[4] = { min_x, min_y, max_x, max_y };
+            kernels<T>().transform_bounded(flat(in), flat(out), n, m, box);
+            return AABB<T> { box[3], box[1], box[0], box[2] };
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        T x = in[i].x;
+        T y = in[i].y;
+        T rx = m00 * x + m01 * y + ox;
+        T ry = m10 * x + m11 * y + oy;
+        out[i].x = rx;
+        out[i].y = ry;
+
+        min_x = rx < min_x ? rx : min_x;
+        min_y = ry < min_y ? ry : min_y;
+        max_x = rx > max_x ? rx : max_x;
+        max_y = ry > max_y ? ry : max_y;
+    }
+
+    return AABB<T> { max_y, min_y, min_x, max_x };
+}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace tiny_colls::details {
+// Disjoint sets over [0, n) with path halving and union by size. reset()
+// keeps the storage so rebuilding every frame does not allocate.
+class union_find {
+public:
+    void reset(size_t n) {
+        parent.resize(n);
+        size.assign(n, 1);
+        std::iota(parent.begin(), parent.end(), uint32_t(0));
+    }
+
+    uint32_t find(uint32_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    }
+
+    void unite(uint32_t a, uint32_t b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return;
+        if (size[a] < size[b]) std::swap(a, b);
+        parent[b] = a;
+        size[a] += size[b];
+    }
+private:
+    std::vector<uint32_t> parent;
+    std::vector<uint32_t> size;
+};
+}
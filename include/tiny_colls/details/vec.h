@@ -4,28 +4,30 @@
 #include <cmath>
 #include <numbers>
 #include <stdexcept>
+#include <algorithm>
+#include "tiny_colls/details/scalar.h"
 
 namespace tiny_colls::details {
 template <typename T>
 class vec {
-    static_assert(std::is_floating_point<T>::value, "vec<T>: T must be numeric");
+    static_assert(scalar<T>, "vec<T>: T must be numeric");
 public:
     explicit vec() {}
     explicit vec(T x, T y) : x(x), y(y) {}
     vec(const vec& other) : x(other.x), y(other.y) {}
 
-    T x = 0;
-    T y = 0;
+    T x = T(0);
+    T y = T(0);
 
     vec<T> rotate(T theta) const {
         return vec<T>(
-            std::cos(theta) * x - std::sin(theta) * y,
-            std::sin(theta) * x + std::cos(theta) * y
+            details::cos(theta) * x - details::sin(theta) * y,
+            details::sin(theta) * x + details::cos(theta) * y
         );
     }
 
     vec<T> rotate_degrees(T theta) const {
-        return rotate(theta * std::numbers::pi / 180);
+        return rotate(theta * pi<T>() / T(180));
     } 
 
     vec<T> operator+(const vec<T> &other) const {
@@ -64,9 +66,25 @@ public:
         return this->x < v.x || (this->x == v.x && this->y < v.y);
     }
 
+    // Largest component magnitude, a length measure that cannot overflow.
+    T largest() const {
+        return std::max(details::abs(this->x), details::abs(this->y));
+    }
+
     vec<T> normalize() const {
-        T magnitude = std::sqrt(this->dot(*this));
-        if (magnitude == 0.0f)
+        if constexpr (!std::is_floating_point_v<T>) {
+            // Fixed point squares overflow quickly, shrink to the unit box first.
+            T largest = this->largest();
+            if (largest == T(0))
+                throw std::logic_error("Cannot normalize {0, 0} vector.");
+
+            vec<T> v(this->x / largest, this->y / largest);
+            T magnitude = details::sqrt(v.dot(v));
+            return vec<T>(v.x / magnitude, v.y / magnitude);
+        }
+
+        T magnitude = details::sqrt(this->dot(*this));
+        if (magnitude == T(0))
             throw std::logic_error("Cannot normalize {0, 0} vector.");
         
         return vec<T>(
@@ -0,0 +1,561 @@
+#pragma once
+
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include "tiny_colls/details/sat.h"
+#include "tiny_colls/details/collider_access.h"
+#include "tiny_colls/details/parallel.h"
+
+namespace tiny_colls {
+template <typename T>
+world<T>::world(T cell_size) : cell_size(cell_size) {
+    if (!(cell_size > T(0))) {
+        throw std::invalid_argument("World cell size must be positive.");
+    }
+}
+
+template <typename T>
+collider_handle world<T>::add(collider<T> c) {
+    // Throws for an empty collider, before a slot is taken.
+    AABB<T> aabb = c.get_bounding_box();
+
+    uint32_t index;
+    if (!free_slots.empty()) {
+        index = free_slots.back();
+        free_slots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    slot& s = slots[index];
+    s.aabb = aabb;
+    s.coll = std::move(c);
+    s.alive = true;
+    s.cells = range_of(s.aabb);
+    insert_cells(index);
+    count++;
+
+    const auto& ci = details::collider_access::impl(s.coll);
+    s.last_x = ci.position.x;
+    s.last_y = ci.position.y;
+    s.last_rotation = ci.rotation;
+    s.idle_frames = 0;
+    mark_awake(index);
+
+    return handle_of(index);
+}
+
+template <typename T>
+void world<T>::remove(collider_handle h) {
+    slot& s = checked(h);
+    wake_island(h.index); // The rest may have rested on it
+    drop_awake(h.index);
+    erase_cells(h.index);
+
+    s.coll = collider<T>();
+    s.alive = false;
+    s.generation++;
+    free_slots.push_back(h.index);
+    count--;
+}
+
+template <typename T>
+bool world<T>::contains(collider_handle h) const {
+    return h.index < slots.size() && slots[h.index].alive && slots[h.index].generation == h.generation;
+}
+
+template <typename T>
+collider<T>& world<T>::get(collider_handle h) {
+    slot& s = checked(h);
+    if (s.sleeping) sleeper_writes.push_back(h.index);
+    return s.coll;
+}
+
+template <typename T>
+const collider<T>& world<T>::get(collider_handle h) const {
+    return checked(h).coll;
+}
+
+template <typename T>
+size_t world<T>::size() const {
+    return count;
+}
+
+template <typename T>
+void world<T>::update(unsigned workers) {
+    if (sleeping.enabled) {
+        for (uint32_t i : wake_requests) {
+            if (i < slots.size() && slots[i].alive) wake_island(i);
+        }
+        wake_requests.clear();
+
+        // A sleeper changed through get() has its transform pending or redone.
+        for (uint32_t i : sleeper_writes) {
+            if (i >= slots.size() || !slots[i].sleeping) continue;
+            const auto& ci = details::collider_access::impl(slots[i].coll);
+            if (ci.dirty || ci.transform_id != slots[i].sleep_transform) wake_island(i);
+        }
+        sleeper_writes.clear();
+    }
+
+    // Transforms are independent per collider, only re-binning touches the grid.
+    // Small worlds stay on the calling thread, a wake up costs more than they do.
+    details::parallel_for(awake.size(), [&](size_t begin, size_t end, unsigned) {
+        for (size_t k = begin; k < end; k++) {
+            slot& s = slots[awake[k]];
+            s.aabb = s.coll.get_bounding_box();
+        }
+    }, workers, 256);
+
+    for (uint32_t i : awake) {
+        slot& s = slots[i];
+        cell_range r = range_of(s.aabb);
+        if (r == s.cells) continue;
+
+        erase_cells(i);
+        s.cells = r;
+        insert_cells(i);
+    }
+
+    if (sleeping.enabled) {
+        for (uint32_t i : awake) track_activity(i);
+        // Without a pair pass since the last update the touching pairs are stale.
+        if (touching_fresh) sleep_idle_islands();
+        touching_fresh = false;
+    }
+}
+
+template <typename T>
+template <typename F>
+void world<T>::for_each_pair(F&& f) {
+    for_each_contact([&](const contact<T>& c) { f(c.a, c.b, c.coll); });
+}
+
+template <typename T>
+template <typename F>
+void world<T>::for_each_contact(F&& f) {
+    if (pair_cache_enabled && ++pair_pass == 0) pair_pass = 1; // 0 marks never visited
+    if (sleeping.enabled) {
+        touching.clear();
+        touching_fresh = true;
+    }
+
+    auto test_pair = [&](uint32_t ia, uint32_t ib, uint64_t key) {
+        slot& a = slots[ia];
+        slot& b = slots[ib];
+
+        if (a.aabb.right < b.aabb.left || b.aabb.right < a.aabb.left) return;
+        if (a.aabb.top < b.aabb.bottom || b.aabb.top < a.aabb.bottom) return;
+
+        // Pairs sharing several cells are only reported from the cell
+        // holding the lower corner of their overlap.
+        int32_t cx = cell_of(std::max(a.aabb.left, b.aabb.left));
+        int32_t cy = cell_of(std::max(a.aabb.bottom, b.aabb.bottom));
+        if (cell_key(cx, cy) != key) return;
+
+        auto& ai = details::collider_access::transformed(a.coll);
+        auto& bi = details::collider_access::transformed(b.coll);
+
+        contact<T> c { handle_of(ia), handle_of(ib), collision<T> {}, 0 };
+        auto narrowphase = [&] {
+            if constexpr (std::is_floating_point_v<T>) {
+                if (mixed_precision) {
+                    return details::sat_mixed(
+                        std::span<const details::vec<T>>(ai.t_vertices), std::span<const details::vec<T>>(ai.t_axes), ai.position,
+                        std::span<const details::vec<T>>(bi.t_vertices), std::span<const details::vec<T>>(bi.t_axes), bi.position,
+                        c.coll, &c.feature
+                    );
+                }
+            }
+            return details::sat(
+                std::span<const details::vec<T>>(ai.t_vertices), std::span<const details::vec<T>>(ai.t_axes), ai.position,
+                std::span<const details::vec<T>>(bi.t_vertices), std::span<const details::vec<T>>(bi.t_axes), bi.position,
+                c.coll, &c.feature
+            );
+        };
+
+        bool hit;
+        if (pair_cache_enabled) {
+            cached_pair& e = pair_cache[(uint64_t(ia) << 32) | ib];
+            if (e.pass != 0 && e.a == c.a && e.b == c.b && e.a_transform == ai.transform_id && e.b_transform == bi.transform_id) {
+                TINY_COLLS_STAT(pair_cache_hits, 1);
+                hit = e.hit;
+                c.coll = e.coll;
+                c.feature = e.feature;
+            } else {
+                hit = narrowphase();
+                e = cached_pair { c.a, c.b, ai.transform_id, bi.transform_id, 0, hit, c.coll, c.feature };
+            }
+            e.pass = pair_pass;
+        } else {
+            hit = narrowphase();
+        }
+
+        if (!hit) return;
+
+        if (sleeping.enabled) {
+            touching.push_back(c);
+            if (a.sleeping) wake_requests.push_back(ia);
+            if (b.sleeping) wake_requests.push_back(ib);
+        }
+        f(c);
+    };
+
+    // Pairs are found from their awake members, so sleeping cells are never
+    // walked. Two awake colliders meet from the lower index only.
+    for (uint32_t self : awake) {
+        const cell_range& r = slots[self].cells;
+        for (int32_t x = r.x0; x <= r.x1; x++) {
+            for (int32_t y = r.y0; y <= r.y1; y++) {
+                uint64_t key = cell_key(x, y);
+                for (uint32_t other : cells.find(key)->second) {
+                    if (other == self || (other < self && !slots[other].sleeping)) continue;
+                    test_pair(std::min(self, other), std::max(self, other), key);
+                }
+            }
+        }
+    }
+
+    // Sleeping islands report the contacts they fell asleep with.
+    for (const auto& [id, island] : islands) {
+        for (const auto& c : island.contacts) f(c);
+    }
+
+    // Pairs that stopped sharing a cell are dropped.
+    if (pair_cache_enabled) {
+        std::erase_if(pair_cache, [&](const auto& kv) { return kv.second.pass != pair_pass; });
+    }
+}
+
+template <typename T>
+void world<T>::set_pair_cache(bool enabled) {
+    pair_cache_enabled = enabled;
+    pair_cache.clear();
+}
+
+template <typename T>
+template <typename F>
+void world<T>::query_aabb(const AABB<T>& box, F&& f) {
+    const std::array<details::vec<T>, 4> corners = {
+        details::vec<T>(box.left, box.bottom), details::vec<T>(box.right, box.bottom),
+        details::vec<T>(box.right, box.top), details::vec<T>(box.left, box.top),
+    };
+    const std::array<details::vec<T>, 2> axes = { details::vec<T>(T(1), T(0)), details::vec<T>(T(0), T(1)) };
+    const details::vec<T> center((box.left + box.right) / T(2), (box.bottom + box.top) / T(2));
+
+    for_each_candidate(box, [&](uint32_t index) {
+        auto& ci = details::collider_access::transformed(slots[index].coll);
+
+        collision<T> c;
+        if (details::sat(
+            std::span<const details::vec<T>>(ci.t_vertices), std::span<const details::vec<T>>(ci.t_axes), ci.position,
+            std::span<const details::vec<T>, 4>(corners), std::span<const details::vec<T>, 2>(axes), center,
+            c
+        )) {
+            f(handle_of(index), c);
+        }
+    });
+}
+
+template <typename T>
+template <typename F>
+void world<T>::query_circle(T x, T y, T radius, F&& f) {
+    const details::vec<T> center(x, y);
+    const AABB<T> box { y + radius, y - radius, x - radius, x + radius };
+
+    for_each_candidate(box, [&](uint32_t index) {
+        auto& ci = details::collider_access::transformed(slots[index].coll);
+
+        collision<T> c;
+        if (details::sat_circle(
+            std::span<const details::vec<T>>(ci.t_vertices), std::span<const details::vec<T>>(ci.t_axes), ci.position,
+            center, radius, c
+        )) {
+            f(handle_of(index), c);
+        }
+    });
+}
+
+template <typename T>
+template <typename F>
+void world<T>::query_collider(const collider<T>& shape, F&& f) {
+    auto& si = details::collider_access::transformed(shape);
+
+    for_each_candidate(si.t_aabb, [&](uint32_t index) {
+        auto& ci = details::collider_access::transformed(slots[index].coll);
+
+        collision<T> c;
+        if (details::sat(
+            std::span<const details::vec<T>>(ci.t_vertices), std::span<const details::vec<T>>(ci.t_axes), ci.position,
+            std::span<const details::vec<T>>(si.t_vertices), std::span<const details::vec<T>>(si.t_axes), si.position,
+            c
+        )) {
+            f(handle_of(index), c);
+        }
+    });
+}
+
+template <typename T>
+size_t world<T>::query_aabb(const AABB<T>& box, std::span<collider_handle> out, std::span<collision<T>> collisions) {
+    size_t n = 0;
+    query_aabb(box, collect(out, collisions, n));
+    return n;
+}
+
+template <typename T>
+size_t world<T>::query_circle(T x, T y, T radius, std::span<collider_handle> out, std::span<collision<T>> collisions) {
+    size_t n = 0;
+    query_circle(x, y, radius, collect(out, collisions, n));
+    return n;
+}
+
+template <typename T>
+size_t world<T>::query_collider(const collider<T>& shape, std::span<collider_handle> out, std::span<collision<T>> collisions) {
+    size_t n = 0;
+    query_collider(shape, collect(out, collisions, n));
+    return n;
+}
+
+template <typename T>
+auto world<T>::collect(std::span<collider_handle> out, std::span<collision<T>> collisions, size_t& n) {
+    return [out, collisions, &n](collider_handle h, const collision<T>& c) {
+        if (n < out.size()) out[n] = h;
+        if (n < collisions.size()) collisions[n] = c;
+        n++;
+    };
+}
+
+template <typename T>
+template <typename F>
+void world<T>::for_each_candidate(const AABB<T>& box, F&& f) {
+    cell_range r = range_of(box);
+
+    auto visit = [&](uint64_t key, const std::vector<uint32_t>& members) {
+        for (uint32_t index : members) {
+            const AABB<T>& a = slots[index].aabb;
+            if (a.right < box.left || box.right < a.left) continue;
+            if (a.top < box.bottom || box.top < a.bottom) continue;
+
+            // Like pairs, reported only from the cell holding the lower corner
+            // of the overlap.
+            int32_t cx = cell_of(std::max(a.left, box.left));
+            int32_t cy = cell_of(std::max(a.bottom, box.bottom));
+            if (cell_key(cx, cy) != key) continue;
+
+            f(index);
+        }
+    };
+
+    if (r.x1 < r.x0 || r.y1 < r.y0) return;
+
+    // Large regions walk the occupied cells instead of every cell they cover.
+    uint64_t covered = uint64_t(int64_t(r.x1) - r.x0 + 1) * uint64_t(int64_t(r.y1) - r.y0 + 1);
+    if (covered > cells.size()) {
+        for (const auto& [key, members] : cells) {
+            int32_t x = int32_t(key >> 32);
+            int32_t y = int32_t(uint32_t(key));
+            if (x < r.x0 || x > r.x1 || y < r.y0 || y > r.y1) continue;
+            visit(key, members);
+        }
+        return;
+    }
+
+    for (int32_t x = r.x0; x <= r.x1; x++) {
+        for (int32_t y = r.y0; y <= r.y1; y++) {
+            uint64_t key = cell_key(x, y);
+            auto it = cells.find(key);
+            if (it != cells.end()) visit(key, it->second);
+        }
+    }
+}
+
+template <typename T>
+void world<T>::set_mixed_precision(bool enabled) requires std::is_floating_point_v<T> {
+    mixed_precision = enabled;
+}
+
+template <typename T>
+void world<T>::set_sleep_options(const sleep_options<T>& options) {
+    if (!options.enabled) {
+        for (uint32_t i = 0; i < slots.size(); i++) {
+            if (slots[i].alive && slots[i].sleeping) mark_awake(i);
+            slots[i].idle_frames = 0;
+        }
+        islands.clear();
+        touching.clear();
+        touching_fresh = false;
+        wake_requests.clear();
+        sleeper_writes.clear();
+    }
+    sleeping = options;
+}
+
+template <typename T>
+bool world<T>::is_sleeping(collider_handle h) const {
+    return checked(h).sleeping;
+}
+
+template <typename T>
+void world<T>::wake(collider_handle h) {
+    checked(h).idle_frames = 0;
+    wake_island(h.index);
+}
+
+template <typename T>
+void world<T>::mark_awake(uint32_t index) {
+    slots[index].sleeping = false;
+    slots[index].awake_at = static_cast<uint32_t>(awake.size());
+    awake.push_back(index);
+}
+
+template <typename T>
+void world<T>::drop_awake(uint32_t index) {
+    uint32_t k = slots[index].awake_at;
+    awake[k] = awake.back();
+    slots[awake[k]].awake_at = k;
+    awake.pop_back();
+}
+
+template <typename T>
+void world<T>::track_activity(uint32_t index) {
+    slot& s = slots[index];
+    const auto& ci = details::collider_access::impl(s.coll);
+
+    bool idle = details::abs(ci.position.x - s.last_x) <= sleeping.linear_threshold
+        && details::abs(ci.position.y - s.last_y) <= sleeping.linear_threshold
+        && details::abs(ci.rotation - s.last_rotation) <= sleeping.angular_threshold;
+    s.idle_frames = idle ? std::min(s.idle_frames + 1, sleeping.frames) : 0;
+
+    s.last_x = ci.position.x;
+    s.last_y = ci.position.y;
+    s.last_rotation = ci.rotation;
+}
+
+template <typename T>
+void world<T>::wake_island(uint32_t index) {
+    if (!slots[index].sleeping) return;
+
+    auto it = islands.find(slots[index].island);
+    for (uint32_t m : it->second.members) {
+        mark_awake(m);
+        slots[m].idle_frames = 0;
+    }
+    islands.erase(it);
+}
+
+template <typename T>
+void world<T>::sleep_idle_islands() {
+    // Sets are over positions in the awake list, sleepers are not visited.
+    // Touching pairs with a sleeper woke it at the start of this update.
+    island_sets.reset(awake.size());
+    for (const auto& c : touching) {
+        if (!contains(c.a) || !contains(c.b)) continue;
+        const slot& a = slots[c.a.index];
+        const slot& b = slots[c.b.index];
+        if (!a.sleeping && !b.sleeping) island_sets.unite(a.awake_at, b.awake_at);
+    }
+
+    island_idle.assign(awake.size(), 1);
+    for (uint32_t k = 0; k < awake.size(); k++) {
+        if (slots[awake[k]].idle_frames < sleeping.frames) island_idle[island_sets.find(k)] = 0;
+    }
+
+    // Roots are unique among this call's islands, offsetting them keeps ids
+    // unique across calls.
+    bool fell_asleep = false;
+    for (uint32_t k = 0; k < awake.size(); k++) {
+        uint32_t root = island_sets.find(k);
+        if (!island_idle[root]) continue;
+
+        slot& s = slots[awake[k]];
+        s.sleeping = true;
+        s.sleep_transform = details::collider_access::impl(s.coll).transform_id;
+        s.island = next_island + root;
+        islands[s.island].members.push_back(awake[k]);
+        fell_asleep = true;
+    }
+    next_island += awake.size();
+    if (!fell_asleep) return;
+
+    // Pairs with both ends asleep now lie within one of the new islands.
+    for (const auto& c : touching) {
+        if (!contains(c.a) || !contains(c.b)) continue;
+        const slot& a = slots[c.a.index];
+        if (a.sleeping && slots[c.b.index].sleeping) islands[a.island].contacts.push_back(c);
+    }
+
+    std::erase_if(awake, [&](uint32_t i) { return slots[i].sleeping; });
+    for (uint32_t k = 0; k < awake.size(); k++) slots[awake[k]].awake_at = k;
+}
+
+template <typename T>
+int32_t world<T>::cell_of(T v) const {
+    // Clamped so empty or degenerate boxes cannot overflow the cell index.
+    const T limit = details::int_limit<T>();
+    return static_cast<int32_t>(std::clamp(details::floor(v / cell_size), -limit, limit));
+}
+
+template <typename T>
+typename world<T>::cell_range world<T>::range_of(const AABB<T>& aabb) const {
+    return cell_range { cell_of(aabb.left), cell_of(aabb.bottom), cell_of(aabb.right), cell_of(aabb.top) };
+}
+
+template <typename T>
+uint64_t world<T>::cell_key(int32_t x, int32_t y) {
+    return (uint64_t(uint32_t(x)) << 32) | uint64_t(uint32_t(y));
+}
+
+template <typename T>
+void world<T>::insert_cells(uint32_t index) {
+    const cell_range& r = slots[index].cells;
+    for (int32_t x = r.x0; x <= r.x1; x++) {
+        for (int32_t y = r.y0; y <= r.y1; y++) {
+            cells[cell_key(x, y)].push_back(index);
+        }
+    }
+}
+
+template <typename T>
+void world<T>::erase_cells(uint32_t index) {
+    const cell_range& r = slots[index].cells;
+    for (int32_t x = r.x0; x <= r.x1; x++) {
+        for (int32_t y = r.y0; y <= r.y1; y++) {
+            auto it = cells.find(cell_key(x, y));
+            if (it == cells.end()) continue;
+
+            auto& members = it->second;
+            auto m = std::find(members.begin(), members.end(), index);
+            if (m != members.end()) {
+                *m = members.back();
+                members.pop_back();
+            }
+
+            if (members.empty()) cells.erase(it);
+        }
+    }
+}
+
+template <typename T>
+typename world<T>::slot& world<T>::checked(collider_handle h) {
+    if (!contains(h)) {
+        throw std::logic_error("Invalid or stale collider handle.");
+    }
+    return slots[h.index];
+}
+
+template <typename T>
+const typename world<T>::slot& world<T>::checked(collider_handle h) const {
+    if (!contains(h)) {
+        throw std::logic_error("Invalid or stale collider handle.");
+    }
+    return slots[h.index];
+}
+
+template <typename T>
+collider_handle world<T>::handle_of(uint32_t index) const {
+    return collider_handle { index, slots[index].generation };
+}
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <limits>
+#include <compare>
+#include <type_traits>
+#include "tiny_colls/details/scalar.h"
+#include "tiny_colls/details/tessellation.h"
+
+namespace tiny_colls {
+// Binary fixed point number with Frac fractional bits stored in Rep. Wide must
+// hold the product of two Reps. Every operation, including sin, cos and sqrt,
+// is integer only so results are bit identical on every machine.
+template <typename Rep, typename Wide, int Frac>
+class fixed {
+    static_assert(std::is_signed_v<Rep> && sizeof(Wide) >= 2 * sizeof(Rep), "fixed: Wide must hold the product of two Reps");
+public:
+    static constexpr int fraction_bits = Frac;
+
+    constexpr fixed() = default;
+
+    template <typename U> requires std::is_arithmetic_v<U>
+    constexpr explicit fixed(U v) : bits(to_bits(v)) {}
+
+    static constexpr fixed from_bits(Rep bits) {
+        fixed f;
+        f.bits = bits;
+        return f;
+    }
+
+    constexpr Rep get_bits() const { return bits; }
+
+    // Integers truncate towards zero, like a float conversion.
+    template <typename U> requires std::is_arithmetic_v<U>
+    constexpr explicit operator U() const {
+        if constexpr (std::is_floating_point_v<U>) {
+            return U(bits) / U(one);
+        } else {
+            return U(bits / one);
+        }
+    }
+
+    constexpr fixed operator+(fixed o) const { return from_bits(bits + o.bits); }
+    constexpr fixed operator-(fixed o) const { return from_bits(bits - o.bits); }
+    constexpr fixed operator-() const { return from_bits(-bits); }
+    constexpr fixed operator*(fixed o) const { return from_bits(Rep((Wide(bits) * Wide(o.bits)) >> Frac)); }
+    constexpr fixed operator/(fixed o) const { return from_bits(Rep((Wide(bits) << Frac) / Wide(o.bits))); }
+
+    constexpr fixed& operator+=(fixed o) { return *this = *this + o; }
+    constexpr fixed& operator-=(fixed o) { return *this = *this - o; }
+    constexpr fixed& operator*=(fixed o) { return *this = *this * o; }
+    constexpr fixed& operator/=(fixed o) { return *this = *this / o; }
+
+    constexpr auto operator<=>(const fixed&) const = default;
+    constexpr bool operator==(const fixed&) const = default;
+private:
+    static constexpr Rep one = Rep(1) << Frac;
+
+    template <typename U>
+    static constexpr Rep to_bits(U v) {
+        if constexpr (std::is_floating_point_v<U>) {
+            double scaled = double(v) * double(one);
+            return Rep(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+        } else {
+            return Rep(Rep(v) * one);
+        }
+    }
+
+    Rep bits = 0;
+};
+
+namespace details {
+template <typename Rep, typename Wide, int Frac>
+struct is_fixed_point<fixed<Rep, Wide, Frac>> : std::true_type {};
+
+inline constexpr size_t sin_table_size = 4096;
+
+// One full period, sampled at compile time so every build holds the same bits.
+template <typename Rep, int Frac>
+constexpr std::array<Rep, sin_table_size + 1> make_sin_table() {
+    std::array<Rep, sin_table_size + 1> table {};
+    for (size_t i = 0; i <= sin_table_size; i++) {
+        double angle = 2 * std::numbers::pi_v<double> * double(i) / double(sin_table_size);
+        double v = const_sin(angle) * double(Rep(1) << Frac);
+        table[i] = Rep(v < 0 ? v - 0.5 : v + 0.5);
+    }
+    return table;
+}
+
+template <typename Rep, int Frac>
+inline constexpr std::array<Rep, sin_table_size + 1> sin_table = make_sin_table<Rep, Frac>();
+}
+
+template <typename Rep, typename Wide, int Frac>
+constexpr fixed<Rep, Wide, Frac> sin(fixed<Rep, Wide, Frac> x) {
+    using F = fixed<Rep, Wide, Frac>;
+    const Wide period = F(2 * std::numbers::pi).get_bits();
+
+    Wide r = Wide(x.get_bits()) % period;
+    if (r < 0) r += period;
+
+    // Table position with 16 bits of interpolation fraction.
+    Wide pos = (r * Wide(details::sin_table_size) << 16) / period;
+    size_t i = size_t(pos >> 16);
+    Wide t = pos & 0xFFFF;
+
+    const auto& table = details::sin_table<Rep, Frac>;
+    Wide a = table[i];
+    Wide b = table[i + 1];
+    return F::from_bits(Rep(a + (((b - a) * t) >> 16)));
+}
+
+template <typename Rep, typename Wide, int Frac>
+constexpr fixed<Rep, Wide, Frac> cos(fixed<Rep, Wide, Frac> x) {
+    using F = fixed<Rep, Wide, Frac>;
+    return sin(x + F(std::numbers::pi / 2));
+}
+
+template <typename Rep, typename Wide, int Frac>
+constexpr fixed<Rep, Wide, Frac> sqrt(fixed<Rep, Wide, Frac> x) {
+    using F = fixed<Rep, Wide, Frac>;
+    if (x.get_bits() <= 0) return F();
+
+    // Integer square root of bits * 2^Frac, one result bit at a time.
+    Wide n = Wide(x.get_bits()) << Frac;
+    Wide result = 0;
+    Wide bit = Wide(1) << (sizeof(Wide) * 8 - 2);
+    while (bit > n) bit >>= 2;
+
+    while (bit != 0) {
+        if (n >= result + bit) {
+            n -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return F::from_bits(Rep(result));
+}
+
+template <typename Rep, typename Wide, int Frac>
+constexpr fixed<Rep, Wide, Frac> abs(fixed<Rep, Wide, Frac> x) {
+    return x.get_bits() < 0 ? -x : x;
+}
+
+template <typename Rep, typename Wide, int Frac>
+constexpr fixed<Rep, Wide, Frac> floor(fixed<Rep, Wide, Frac> x) {
+    using F = fixed<Rep, Wide, Frac>;
+    return F::from_bits(Rep((x.get_bits() >> Frac) * (Rep(1) << Frac)));
+}
+
+using q16_16 = fixed<int32_t, int64_t, 16>;
+#ifdef __SIZEOF_INT128__
+using q32_32 = fixed<int64_t, __int128, 32>;
+#endif
+}
+
+template <typename Rep, typename Wide, int Frac>
+class std::numeric_limits<tiny_colls::fixed<Rep, Wide, Frac>> {
+    using F = tiny_colls::fixed<Rep, Wide, Frac>;
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = true;
+
+    static constexpr F min() noexcept { return F::from_bits(std::numeric_limits<Rep>::min()); }
+    static constexpr F lowest() noexcept { return F::from_bits(std::numeric_limits<Rep>::min()); }
+    static constexpr F max() noexcept { return F::from_bits(std::numeric_limits<Rep>::max()); }
+    static constexpr F epsilon() noexcept { return F::from_bits(1); }
+};
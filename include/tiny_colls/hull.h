@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "tiny_colls/point.h"
+
+namespace tiny_colls {
+template <typename T>
+struct hull_options {
+    // Drop points inside the octagon of extreme points before sorting.
+    bool prefilter = true;
+    // Sort on all hardware threads, worth it from about 100k points.
+    bool parallel = false;
+    // Remove the vertices that move the hull least until at most
+    // max_vertices remain (0 keeps all), but never one further than
+    // max_error from the simplified outline.
+    size_t max_vertices = 0;
+    T max_error = std::numeric_limits<T>::max();
+};
+
+// Counter clockwise convex hull starting at the leftmost, lowest point.
+template <typename T>
+std::vector<point<T>> convex_hull(const std::vector<point<T>>& points, const hull_options<T>& options = {});
+
+using hull_options_f = hull_options<float>;
+using hull_options_d = hull_options<double>;
+}
+
+#include "tiny_colls/details/hull_impl.h"
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+#include "tiny_colls/aabb.h"
+
+namespace tiny_colls {
+// Linear bounding volume hierarchy rebuilt from scratch every frame, for
+// scenes where nearly everything moves. Boxes are ordered along a Morton
+// curve by radix sort and every node is emitted independently (Karras 2012),
+// so each stage of the build runs in parallel.
+template<typename T>
+class lbvh {
+public:
+    // Box i becomes leaf i. `workers` threads, 0 for one per core.
+    void build(std::span<const AABB<T>> boxes, unsigned workers = 0);
+    size_t size() const;
+
+    // f(uint32_t a, uint32_t b) for every overlapping pair of boxes, a < b,
+    // each pair once.
+    template<typename F>
+    void for_each_overlap(F&& f) const;
+    // Same pairs, traversed on `workers` threads. f(a, b, unsigned worker) is
+    // called concurrently, worker is below the thread count and can index
+    // per thread output.
+    template<typename F>
+    void for_each_overlap_parallel(F&& f, unsigned workers = 0) const;
+    // f(uint32_t i) for every box overlapping `box`.
+    template<typename F>
+    void query(const AABB<T>& box, F&& f) const;
+private:
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    // Internal nodes first, then one leaf per box in Morton order.
+    struct node {
+        AABB<T> box {};
+        uint32_t left = none;
+        uint32_t right = none;
+        uint32_t parent = none;
+        // Range of Morton ordered leaves below the node.
+        uint32_t first = 0;
+        uint32_t last = 0;
+        uint32_t item = none;
+    };
+
+    int common_prefix(int64_t i, int64_t j) const;
+    void emit_internal(uint32_t i);
+
+    template<typename F>
+    void overlaps_of(uint32_t position, F&& f) const;
+
+    size_t count = 0;
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> scratch;
+    std::vector<node> nodes;
+    std::unique_ptr<std::atomic<uint32_t>[]> visits;
+    size_t visits_size = 0;
+};
+
+using lbvh_f = lbvh<float>;
+using lbvh_d = lbvh<double>;
+}
+
+#include "tiny_colls/details/lbvh_impl.h"
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include "tiny_colls/point.h"
+#include "tiny_colls/details/vec.h"
+
+namespace tiny_colls {
+// Read only view over a collider's cached transformed points, yielding
+// point<T> by value. Nothing is copied until an element is read.
+template <typename T>
+class shape_view {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = point<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = point<T>;
+
+        iterator() = default;
+        explicit iterator(const details::vec<T>* p) : p(p) {}
+
+        point<T> operator*() const { return { p->x, p->y }; }
+        point<T> operator[](difference_type i) const { return { p[i].x, p[i].y }; }
+
+        iterator& operator++() { ++p; return *this; }
+        iterator operator++(int) { iterator it = *this; ++p; return it; }
+        iterator& operator--() { --p; return *this; }
+        iterator operator--(int) { iterator it = *this; --p; return it; }
+        iterator& operator+=(difference_type n) { p += n; return *this; }
+        iterator& operator-=(difference_type n) { p -= n; return *this; }
+
+        friend iterator operator+(iterator it, difference_type n) { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(iterator a, iterator b) { return a.p - b.p; }
+
+        bool operator==(const iterator&) const = default;
+        auto operator<=>(const iterator&) const = default;
+    private:
+        const details::vec<T>* p = nullptr;
+    };
+
+    shape_view() = default;
+    shape_view(const details::vec<T>* data, size_t size) : data(data), count(size) {}
+
+    iterator begin() const { return iterator(data); }
+    iterator end() const { return iterator(data + count); }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    point<T> operator[](size_t i) const { return { data[i].x, data[i].y }; }
+private:
+    const details::vec<T>* data = nullptr;
+    size_t count = 0;
+};
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tiny_colls {
+// Instruction sets the float and double kernels (projection, batch transform
+// and batch point tests) are compiled for. Other coordinate types always use
+// the portable header code.
+enum class simd_level : uint8_t {
+    scalar,
+    sse2,
+    avx2,
+    avx512,
+};
+
+// Chosen once at startup, the highest level the CPU supports capped by the
+// TINY_COLLS_SIMD environment variable (scalar, sse2, avx2 or avx512).
+simd_level get_simd_level();
+// Highest level both this build and the CPU support.
+simd_level get_max_simd_level();
+// Forces a level, mainly for testing. Every level gives bit identical
+// results. Throws std::invalid_argument above get_max_simd_level(). Must not
+// race with collision queries on other threads.
+void set_simd_level(simd_level level);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "tiny_colls/world.h"
+
+namespace tiny_colls {
+template<typename T>
+struct solver_options {
+    uint32_t iterations = 4;
+    // Penetration left in place, keeps resting contacts from jittering.
+    T slop = T(0);
+    // Threads for colors of at least 4096 contacts, 0 for one per core.
+    unsigned workers = 0;
+};
+
+// Pushes colliding bodies apart along their contact MTVs, iterating so
+// bodies in several contacts settle. Contacts are colored so no two in a
+// color share a body; each color is then split across threads without
+// locks. Within a thread contacts run one at a time, the body gathers and
+// scatters keep the loop scalar.
+template<typename T>
+class overlap_solver {
+public:
+    explicit overlap_solver(const solver_options<T>& options = {});
+
+    // Every body moves, sharing each correction equally.
+    void solve(world<T>& w, std::span<const contact<T>> contacts);
+    // inverse_mass(collider_handle h) -> T weighs how much of a correction a
+    // body takes, 0 keeps it in place.
+    template<typename F>
+    void solve(world<T>& w, std::span<const contact<T>> contacts, F&& inverse_mass);
+
+    // Colors used by the last solve.
+    size_t color_count() const;
+private:
+    static constexpr uint32_t none = UINT32_MAX;
+    // Colors are tracked in a 64 bit mask per body, contacts that find
+    // none free go to a last batch solved on one thread.
+    static constexpr uint32_t max_colors = 64;
+
+    void solve_batch(size_t begin, size_t end, unsigned workers);
+
+    solver_options<T> options;
+
+    std::vector<uint32_t> body_of;
+    std::vector<collider_handle> bodies;
+    std::vector<T> inv_mass;
+    std::vector<T> dx;
+    std::vector<T> dy;
+    std::vector<uint64_t> used_colors;
+
+    // Contacts sorted by color, stored as separate arrays.
+    std::vector<uint32_t> color_of;
+    std::array<size_t, max_colors + 2> color_start {};
+    size_t colors = 0;
+    std::vector<uint32_t> body_a;
+    std::vector<uint32_t> body_b;
+    std::vector<T> nx;
+    std::vector<T> ny;
+    std::vector<T> depth;
+    // Parts of a correction taken by each body, fixed for the whole solve.
+    std::vector<T> share_a;
+    std::vector<T> share_b;
+};
+
+using solver_options_f = solver_options<float>;
+using solver_options_d = solver_options<double>;
+
+using overlap_solver_f = overlap_solver<float>;
+using overlap_solver_d = overlap_solver<double>;
+}
+
+#include "tiny_colls/details/solver_impl.h"
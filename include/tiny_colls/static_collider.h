@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <cmath>
+#include <stdexcept>
+#include "tiny_colls/collider.h"
+#include "tiny_colls/collision.h"
+#include "tiny_colls/point.h"
+#include "tiny_colls/aabb.h"
+#include "tiny_colls/details/vec.h"
+#include "tiny_colls/details/scalar.h"
+#include "tiny_colls/details/sat.h"
+
+namespace tiny_colls {
+// Collider with N vertices stored inline, for small shapes that should not pay
+// for heap storage. Runs the same SAT as collider with loops bounded by N.
+template<typename T, size_t N>
+class static_collider {
+    static_assert(details::scalar<T>, "static_collider<T, N>: T must be floating or fixed point");
+    static_assert(N >= 2, "static_collider<T, N>: N must be 2 or higher");
+public:
+    static_collider() = default;
+    explicit static_collider(const std::array<point<T>, N>& points);
+
+    static_collider& set_position(T x, T y);
+    static_collider& set_rotation(T rotation);
+
+    std::array<point<T>, N> get_shape() const;
+    AABB<T> get_bounding_box() const;
+
+    bool is_point_in(T x, T y);
+    template<size_t M>
+    bool is_colliding_with(const static_collider<T, M>& other, collision<T>& out);
+    bool is_colliding_with(const collider<T>& other, collision<T>& out);
+
+    static static_collider rect(T width, T height) requires (N == 4);
+    static static_collider line(T length) requires (N == 4);
+    static static_collider poly(T width, T height);
+    static static_collider ellipse(T a, T b);
+    static static_collider circle(T radius);
+private:
+    template<typename U, size_t M> friend class static_collider;
+
+    using vec = details::vec<T>;
+
+    void ensure_transformed() const;
+    std::span<const vec> axes() const;
+
+    std::array<vec, N> vertices;
+    vec position = vec(T(0), T(0));
+    T rotation = T(0);
+
+    mutable std::array<vec, N> t_vertices;
+    mutable std::array<vec, N> t_axes;
+    mutable size_t axis_count = 0;
+    mutable AABB<T> t_aabb {};
+    mutable bool dirty = true;
+};
+
+template<size_t N> using static_collider_f = static_collider<float, N>;
+template<size_t N> using static_collider_d = static_collider<double, N>;
+}
+
+#include "tiny_colls/details/static_collider_impl.h"
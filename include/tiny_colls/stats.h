@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+
+namespace tiny_colls {
+// Hot path event counts. Only collected when built with TINY_COLLS_STATS
+// (CMake option of the same name), otherwise every counter stays zero and
+// the counting compiles away.
+struct stats {
+    uint64_t narrowphase_calls = 0;
+    uint64_t axes_tested = 0;
+    uint64_t early_outs = 0;
+    uint64_t projections = 0;
+    uint64_t transforms = 0;
+    uint64_t allocations = 0;
+    uint64_t pair_cache_hits = 0;
+};
+
+// Sum over all threads, including exited ones, since the last reset_stats().
+stats stats_snapshot();
+void reset_stats();
+
+namespace details {
+// Written only by the owning thread, so counting is a plain load and store.
+struct stat_counters {
+    std::atomic<uint64_t> narrowphase_calls = 0;
+    std::atomic<uint64_t> axes_tested = 0;
+    std::atomic<uint64_t> early_outs = 0;
+    std::atomic<uint64_t> projections = 0;
+    std::atomic<uint64_t> transforms = 0;
+    std::atomic<uint64_t> allocations = 0;
+    std::atomic<uint64_t> pair_cache_hits = 0;
+
+    stat_counters();
+    ~stat_counters();
+};
+
+#ifdef TINY_COLLS_STATS
+inline thread_local stat_counters thread_counters;
+
+inline void count(std::atomic<uint64_t>& counter, uint64_t n) {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+#endif
+}
+}
+
+#ifdef TINY_COLLS_STATS
+#define TINY_COLLS_STAT(field, n) ::tiny_colls::details::count(::tiny_colls::details::thread_counters.field, (n))
+#else
+#define TINY_COLLS_STAT(field, n) ((void)0)
+#endif
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <istream>
+#include <ostream>
+#include "tiny_colls/collider.h"
+#include "tiny_colls/world.h"
+
+namespace tiny_colls {
+struct chunk_coord {
+    int32_t x = 0;
+    int32_t y = 0;
+
+    bool operator==(const chunk_coord&) const = default;
+};
+
+// Pages square regions of colliders in and out of a world. Chunks are read and
+// built on a background thread, then spliced into the world a bounded number of
+// colliders at a time from update().
+template<typename T>
+class chunk_streamer {
+public:
+    // Returns one raw record (see collider::raw) per collider in the chunk.
+    // Called from the background thread.
+    using loader = std::function<std::vector<std::vector<T>>(chunk_coord)>;
+
+    chunk_streamer(world<T>& w, T chunk_size, loader load);
+    ~chunk_streamer();
+    chunk_streamer(const chunk_streamer&) = delete;
+    chunk_streamer& operator=(const chunk_streamer&) = delete;
+
+    void load(chunk_coord c);
+    void unload(chunk_coord c);
+    // Loads every chunk within radius chunks of (x, y) and unloads all others.
+    void set_focus(T x, T y, int radius);
+
+    // Splices at most max_insertions built colliders into the world and returns
+    // how many were inserted. Rethrows errors raised by the loader.
+    size_t update(size_t max_insertions);
+
+    bool is_resident(chunk_coord c) const;
+    size_t pending() const;
+    const std::vector<collider_handle>& handles(chunk_coord c) const;
+private:
+    enum class chunk_state { loading, splicing, resident };
+
+    struct chunk {
+        chunk_state state = chunk_state::loading;
+        uint64_t ticket = 0;
+        std::vector<collider<T>> built;
+        size_t next = 0;
+        std::vector<collider_handle> handles;
+    };
+
+    struct job {
+        chunk_coord coord;
+        uint64_t ticket;
+    };
+
+    struct result {
+        chunk_coord coord;
+        uint64_t ticket;
+        std::vector<collider<T>> built;
+        std::exception_ptr error;
+    };
+
+    static uint64_t key_of(chunk_coord c);
+    void run();
+
+    world<T>& w;
+    T chunk_size;
+    loader load_chunk;
+
+    std::unordered_map<uint64_t, chunk> chunks;
+    std::deque<chunk_coord> splicing;
+    uint64_t next_ticket = 0;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<job> jobs;
+    std::vector<result> results;
+    bool stopping = false;
+    std::thread worker;
+};
+
+// BINARY CHUNK FORMAT (native endianness)
+// uint32:          collider count
+// per collider:    uint32 value count, followed by that many T in raw format
+template<typename T>
+void write_chunk(std::ostream& out, const std::vector<collider<T>>& colliders);
+template<typename T>
+std::vector<std::vector<T>> read_chunk(std::istream& in);
+
+using chunk_streamer_f = chunk_streamer<float>;
+using chunk_streamer_d = chunk_streamer<double>;
+}
+
+#include "tiny_colls/details/streaming_impl.h"
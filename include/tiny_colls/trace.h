@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+#include "tiny_colls/collider.h"
+#include "tiny_colls/world.h"
+#include "tiny_colls/lbvh.h"
+
+namespace tiny_colls {
+// TRACE FORMAT
+// header: "TCTR", u32 version, u32 sizeof(T)
+// then events, each a u8 trace_event followed by its payload:
+//   add:          u32 id, u32 n, T[n] raw data (see collider::raw)
+//   remove:       u32 id
+//   set_position: u32 id, T x, T y
+//   set_rotation: u32 id, T rotation
+//   query_aabb:   T top, T bottom, T left, T right
+//   query_circle: T x, T y, T radius
+//   update, contacts, end_frame: nothing
+// Ids are world slot indices, unique among live colliders. A trace ends with
+// end_frame, or holds no events at all.
+enum class trace_event : uint8_t {
+    add = 1,
+    remove,
+    set_position,
+    set_rotation,
+    update,
+    query_aabb,
+    query_circle,
+    contacts,
+    end_frame,
+};
+
+// Forwards every call to a world and appends it to a trace. Shapes are stored
+// as raw vertex data only, so traces carry no game specific information.
+template<typename T>
+class trace_recorder {
+public:
+    trace_recorder(world<T>& w, std::ostream& out);
+
+    collider_handle add(collider<T> c);
+    void remove(collider_handle h);
+    void set_position(collider_handle h, T x, T y);
+    void set_rotation(collider_handle h, T rotation);
+    void update();
+
+    template<typename F>
+    void query_aabb(const AABB<T>& box, F&& f);
+    template<typename F>
+    void query_circle(T x, T y, T radius, F&& f);
+    template<typename F>
+    void for_each_contact(F&& f);
+
+    // Frames are the unit replay timings are reported in.
+    void end_frame();
+private:
+    void event(trace_event e);
+    template<typename V>
+    void put(const V& v);
+
+    world<T>& w;
+    std::ostream& out;
+};
+
+enum class replay_broadphase {
+    grid,
+    lbvh,
+};
+
+template<typename T>
+struct replay_options {
+    replay_broadphase broadphase = replay_broadphase::grid;
+    T cell_size = T(64);
+    bool pair_cache = false;
+    // Floating point only.
+    bool mixed_precision = false;
+    unsigned workers = 1;
+};
+
+struct replay_result {
+    std::vector<double> frame_ms;
+    uint64_t contacts = 0;
+    uint64_t query_hits = 0;
+
+    // Frame time below which p percent of frames fall, p in [0, 100].
+    double percentile(double p) const;
+};
+
+// Re-executes a trace on a fresh world configured by `options`, timing every
+// frame. Throws std::invalid_argument on malformed traces.
+template<typename T>
+replay_result replay_trace(std::istream& in, const replay_options<T>& options = {});
+
+using trace_recorder_f = trace_recorder<float>;
+using trace_recorder_d = trace_recorder<double>;
+using replay_options_f = replay_options<float>;
+using replay_options_d = replay_options<double>;
+}
+
+#include "tiny_colls/details/trace_impl.h"
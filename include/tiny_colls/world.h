@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <limits>
+#include <unordered_map>
+#include "tiny_colls/collider.h"
+#include "tiny_colls/collision.h"
+#include "tiny_colls/aabb.h"
+#include "tiny_colls/details/union_find.h"
+
+namespace tiny_colls {
+struct collider_handle {
+    uint32_t index = std::numeric_limits<uint32_t>::max();
+    uint32_t generation = 0;
+
+    bool operator==(const collider_handle&) const = default;
+};
+
+template<typename T>
+struct contact {
+    collider_handle a;
+    collider_handle b;
+    collision<T> coll;
+    // Index of the axis giving the MTV, a's axes first and b's after.
+    uint32_t feature = 0;
+};
+
+template<typename T>
+struct sleep_options {
+    bool enabled = true;
+    // A collider is idle while it moves at most this far per update on each
+    // axis and turns at most angular_threshold radians.
+    T linear_threshold = T(0.01);
+    T angular_threshold = T(0.01);
+    // Updates an island of touching colliders must stay idle to fall asleep.
+    uint32_t frames = 60;
+};
+
+// Owns a set of colliders addressed by handles and keeps them binned in a
+// uniform grid so pairs and regions can be found without testing every collider.
+template<typename T>
+class world {
+public:
+    explicit world(T cell_size = T(64));
+
+    collider_handle add(collider<T> c);
+    void remove(collider_handle h);
+    bool contains(collider_handle h) const;
+
+    collider<T>& get(collider_handle h);
+    const collider<T>& get(collider_handle h) const;
+    size_t size() const;
+
+    // Re-bins colliders whose bounding box moved to other cells. Call once per
+    // frame after moving colliders and before querying pairs. Moved colliders
+    // are transformed on `workers` threads, 0 for one per core.
+    void update(unsigned workers = 1);
+
+    // f(collider_handle a, collider_handle b, const collision<T>& c) for every
+    // colliding pair, each pair reported once.
+    template<typename F>
+    void for_each_pair(F&& f);
+    // f(const contact<T>& c) for every colliding pair, each pair reported once
+    // with a.index < b.index.
+    template<typename F>
+    void for_each_contact(F&& f);
+
+    // Keeps the narrowphase result of every candidate pair between passes and
+    // reuses it while neither collider was transformed again. Pays off when
+    // most colliders are idle. Off by default.
+    void set_pair_cache(bool enabled);
+    // Pair tests use collider::is_colliding_with_mixed. Off by default.
+    void set_mixed_precision(bool enabled) requires std::is_floating_point_v<T>;
+
+    // Islands of touching colliders that stayed idle long enough fall asleep:
+    // update() and the pair pass only walk awake colliders, and the contacts
+    // an island had when it fell asleep are reported again as they were. An
+    // island wakes when one of its colliders is changed through get() before
+    // the next update(), removed or woken, or when an awake collider touches
+    // it. Islands only fall asleep in an update() following a pair pass, the
+    // pass being what finds them. Off by default.
+    void set_sleep_options(const sleep_options<T>& options);
+    bool is_sleeping(collider_handle h) const;
+    void wake(collider_handle h);
+
+    // Region queries use the grid as of the last update() and allocate nothing.
+    // The callbacks take f(collider_handle h, const collision<T>& c), c pushing
+    // the found collider out of the region. Each collider is reported once.
+    template<typename F>
+    void query_aabb(const AABB<T>& box, F&& f);
+    template<typename F>
+    void query_circle(T x, T y, T radius, F&& f);
+    // A shape that is itself in the world reports itself too.
+    template<typename F>
+    void query_collider(const collider<T>& shape, F&& f);
+
+    // Buffer variants store the first out.size() hits, and their collisions
+    // when `collisions` is not empty, returning the total number of hits.
+    size_t query_aabb(const AABB<T>& box, std::span<collider_handle> out, std::span<collision<T>> collisions = {});
+    size_t query_circle(T x, T y, T radius, std::span<collider_handle> out, std::span<collision<T>> collisions = {});
+    size_t query_collider(const collider<T>& shape, std::span<collider_handle> out, std::span<collision<T>> collisions = {});
+private:
+    struct cell_range {
+        int32_t x0 = 0;
+        int32_t y0 = 0;
+        int32_t x1 = -1;
+        int32_t y1 = -1;
+
+        bool operator==(const cell_range&) const = default;
+    };
+
+    struct slot {
+        collider<T> coll;
+        AABB<T> aabb {};
+        cell_range cells;
+        uint32_t generation = 0;
+        bool alive = false;
+
+        // Activity tracking, only used with sleeping enabled.
+        T last_x = T(0);
+        T last_y = T(0);
+        T last_rotation = T(0);
+        uint32_t idle_frames = 0;
+        uint64_t island = 0;
+        uint64_t sleep_transform = 0;
+        uint32_t awake_at = 0;
+        bool sleeping = false;
+    };
+
+    struct resting_island {
+        std::vector<uint32_t> members;
+        std::vector<contact<T>> contacts;
+    };
+
+    int32_t cell_of(T v) const;
+    cell_range range_of(const AABB<T>& aabb) const;
+    static uint64_t cell_key(int32_t x, int32_t y);
+
+    // f(uint32_t index) once for every collider whose box overlaps `box`.
+    template<typename F>
+    void for_each_candidate(const AABB<T>& box, F&& f);
+    static auto collect(std::span<collider_handle> out, std::span<collision<T>> collisions, size_t& n);
+
+    void insert_cells(uint32_t index);
+    void erase_cells(uint32_t index);
+
+    slot& checked(collider_handle h);
+    const slot& checked(collider_handle h) const;
+    collider_handle handle_of(uint32_t index) const;
+
+    void mark_awake(uint32_t index);
+    void drop_awake(uint32_t index);
+    void track_activity(uint32_t index);
+    void wake_island(uint32_t index);
+    void sleep_idle_islands();
+
+    struct cached_pair {
+        collider_handle a;
+        collider_handle b;
+        uint64_t a_transform = 0;
+        uint64_t b_transform = 0;
+        uint32_t pass = 0;
+        bool hit = false;
+        collision<T> coll {};
+        uint32_t feature = 0;
+    };
+
+    T cell_size;
+    std::vector<slot> slots;
+    std::vector<uint32_t> free_slots;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+    size_t count = 0;
+
+    bool pair_cache_enabled = false;
+    bool mixed_precision = false;
+    std::unordered_map<uint64_t, cached_pair> pair_cache;
+    uint32_t pair_pass = 0;
+
+    sleep_options<T> sleeping { false };
+    // Alive colliders that are not sleeping, slot::awake_at indexes into it.
+    std::vector<uint32_t> awake;
+    // Touching pairs of the last pass, the edges islands are built from.
+    std::vector<contact<T>> touching;
+    bool touching_fresh = false;
+    std::vector<uint32_t> wake_requests;
+    // Sleepers handed out by get(), checked for changes on the next update().
+    std::vector<uint32_t> sleeper_writes;
+    std::unordered_map<uint64_t, resting_island> islands;
+    uint64_t next_island = 0;
+    details::union_find island_sets;
+    std::vector<uint8_t> island_idle;
+};
+
+using world_f = world<float>;
+using world_d = world<double>;
+
+using sleep_options_f = sleep_options<float>;
+using sleep_options_d = sleep_options<double>;
+
+using contact_f = contact<float>;
+using contact_d = contact<double>;
+}
+
+#include "tiny_colls/details/world_impl.h"
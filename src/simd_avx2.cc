@@ -0,0 +1,45 @@
+#include <immintrin.h>
+#include "simd_kernels.h"
+
+namespace tiny_colls::details {
+namespace {
+struct avx2_f {
+    using scalar = float;
+    using reg = __m256;
+    static constexpr size_t lanes = 8;
+
+    static reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg v) { _mm256_storeu_ps(p, v); }
+    static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+    static reg swap(reg v) { return _mm256_permute_ps(v, 0xB1); }
+    static unsigned outside(reg d, reg lo, reg hi) {
+        return _mm256_movemask_ps(_mm256_or_ps(_mm256_cmp_ps(d, lo, _CMP_LT_OQ), _mm256_cmp_ps(d, hi, _CMP_GT_OQ)));
+    }
+};
+
+struct avx2_d {
+    using scalar = double;
+    using reg = __m256d;
+    static constexpr size_t lanes = 4;
+
+    static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm256_storeu_pd(p, v); }
+    static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+    static reg swap(reg v) { return _mm256_permute_pd(v, 0b0101); }
+    static unsigned outside(reg d, reg lo, reg hi) {
+        return _mm256_movemask_pd(_mm256_or_pd(_mm256_cmp_pd(d, lo, _CMP_LT_OQ), _mm256_cmp_pd(d, hi, _CMP_GT_OQ)));
+    }
+};
+}
+
+extern const kernel_table<float> avx2_kernels_f;
+extern const kernel_table<double> avx2_kernels_d;
+constinit const kernel_table<float> avx2_kernels_f = vector_table<avx2_f>();
+constinit const kernel_table<double> avx2_kernels_d = vector_table<avx2_d>();
+}
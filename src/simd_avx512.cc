@@ -0,0 +1,49 @@
+// GCC 12 warns about the deliberately undefined pass through operands inside
+// its own AVX-512 intrinsics.
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+#include <immintrin.h>
+#include "simd_kernels.h"
+
+namespace tiny_colls::details {
+namespace {
+struct avx512_f {
+    using scalar = float;
+    using reg = __m512;
+    static constexpr size_t lanes = 16;
+
+    static reg load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, reg v) { _mm512_storeu_ps(p, v); }
+    static reg add(reg a, reg b) { return _mm512_add_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm512_mul_ps(a, b); }
+    static reg min(reg a, reg b) { return _mm512_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm512_max_ps(a, b); }
+    static reg swap(reg v) { return _mm512_permute_ps(v, 0xB1); }
+    static unsigned outside(reg d, reg lo, reg hi) {
+        return _mm512_cmp_ps_mask(d, lo, _CMP_LT_OQ) | _mm512_cmp_ps_mask(d, hi, _CMP_GT_OQ);
+    }
+};
+
+struct avx512_d {
+    using scalar = double;
+    using reg = __m512d;
+    static constexpr size_t lanes = 8;
+
+    static reg load(const double* p) { return _mm512_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm512_storeu_pd(p, v); }
+    static reg add(reg a, reg b) { return _mm512_add_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm512_mul_pd(a, b); }
+    static reg min(reg a, reg b) { return _mm512_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm512_max_pd(a, b); }
+    static reg swap(reg v) { return _mm512_permute_pd(v, 0x55); }
+    static unsigned outside(reg d, reg lo, reg hi) {
+        return _mm512_cmp_pd_mask(d, lo, _CMP_LT_OQ) | _mm512_cmp_pd_mask(d, hi, _CMP_GT_OQ);
+    }
+};
+}
+
+extern const kernel_table<float> avx512_kernels_f;
+extern const kernel_table<double> avx512_kernels_d;
+constinit const kernel_table<float> avx512_kernels_f = vector_table<avx512_f>();
+constinit const kernel_table<double> avx512_kernels_d = vector_table<avx512_d>();
+}
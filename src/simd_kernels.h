@@ -0,0 +1,229 @@
+// Kernel bodies shared by every instruction set. Each translation unit that
+// includes this gets its own internal copies, so code built with -mavx2 in
+// one never replaces the baseline code of another at link time. Everything
+// works on raw interleaved arrays and calls nothing, for the same reason.
+//
+// Vector kernels are written against a traits type S providing the register
+// type, its lane count and a handful of operations. Every result is computed
+// with the same operations in the same order as the scalar loops, so all
+// levels agree bit for bit.
+
+#include <cstddef>
+#include <limits>
+#include "tiny_colls/details/dispatch.h"
+
+namespace tiny_colls::details {
+namespace {
+template <typename T>
+void scalar_project(const T* points, size_t n, T axis_x, T axis_y, T& min, T& max) {
+    for (size_t i = 0; i < n; i++) {
+        T dot = axis_x * points[2 * i] + axis_y * points[2 * i + 1];
+        if (dot < min) min = dot;
+        if (dot > max) max = dot;
+    }
+}
+
+template <typename T>
+void scalar_transform(const T* in, T* out, size_t n, const T* m) {
+    for (size_t i = 0; i < n; i++) {
+        T x = in[2 * i];
+        T y = in[2 * i + 1];
+        out[2 * i] = m[0] * x + m[1] * y + m[4];
+        out[2 * i + 1] = m[2] * x + m[3] * y + m[5];
+    }
+}
+
+template <typename T>
+void scalar_transform_bounded(const T* in, T* out, size_t n, const T* m, T* box) {
+    for (size_t i = 0; i < n; i++) {
+        T x = in[2 * i];
+        T y = in[2 * i + 1];
+        T rx = m[0] * x + m[1] * y + m[4];
+        T ry = m[2] * x + m[3] * y + m[5];
+        out[2 * i] = rx;
+        out[2 * i + 1] = ry;
+
+        box[0] = rx < box[0] ? rx : box[0];
+        box[1] = ry < box[1] ? ry : box[1];
+        box[2] = rx > box[2] ? rx : box[2];
+        box[3] = ry > box[3] ? ry : box[3];
+    }
+}
+
+template <typename T>
+void scalar_points_in(T axis_x, T axis_y, T min, T max, const T* points, size_t pn, bool* out) {
+    for (size_t i = 0; i < pn; i++) {
+        T dot = axis_x * points[2 * i] + axis_y * points[2 * i + 1];
+        if (max < dot || dot < min) out[i] = false;
+    }
+}
+
+// Register holding (a, b, a, b, ...).
+template <typename S>
+typename S::reg splat_pair(typename S::scalar a, typename S::scalar b) {
+    alignas(64) typename S::scalar lanes[S::lanes];
+    for (size_t i = 0; i < S::lanes; i += 2) {
+        lanes[i] = a;
+        lanes[i + 1] = b;
+    }
+    return S::load(lanes);
+}
+
+// Each register holds lanes / 2 points. Multiplying by (ax, ay) and adding
+// the pair swapped puts every point's dot product in both of its lanes.
+template <typename S>
+void vector_project(const typename S::scalar* points, size_t n, typename S::scalar axis_x, typename S::scalar axis_y, typename S::scalar& min, typename S::scalar& max) {
+    using T = typename S::scalar;
+    constexpr size_t step = S::lanes / 2;
+
+    T init_min = std::numeric_limits<T>::max();
+    T init_max = std::numeric_limits<T>::lowest();
+    auto axis = splat_pair<S>(axis_x, axis_y);
+    auto lo = splat_pair<S>(init_min, init_min);
+    auto hi = splat_pair<S>(init_max, init_max);
+
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        auto d = S::mul(axis, S::load(points + 2 * i));
+        auto dot = S::add(d, S::swap(d));
+        lo = S::min(dot, lo);
+        hi = S::max(dot, hi);
+    }
+
+    alignas(64) T lo_lanes[S::lanes];
+    alignas(64) T hi_lanes[S::lanes];
+    S::store(lo_lanes, lo);
+    S::store(hi_lanes, hi);
+    for (size_t l = 0; l < S::lanes; l++) {
+        if (lo_lanes[l] < min) min = lo_lanes[l];
+        if (hi_lanes[l] > max) max = hi_lanes[l];
+    }
+    scalar_project(points + 2 * i, n - i, axis_x, axis_y, min, max);
+}
+
+// (x, y) * (m00, m11) + (y, x) * (m01, m10) + (ox, oy), the same products
+// and sums as the scalar loop.
+template <typename S>
+void vector_transform(const typename S::scalar* in, typename S::scalar* out, size_t n, const typename S::scalar* m) {
+    constexpr size_t step = S::lanes / 2;
+    auto a = splat_pair<S>(m[0], m[3]);
+    auto b = splat_pair<S>(m[1], m[2]);
+    auto o = splat_pair<S>(m[4], m[5]);
+
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        auto p = S::load(in + 2 * i);
+        S::store(out + 2 * i, S::add(S::add(S::mul(a, p), S::mul(b, S::swap(p))), o));
+    }
+    scalar_transform(in + 2 * i, out + 2 * i, n - i, m);
+}
+
+template <typename S>
+void vector_transform_bounded(const typename S::scalar* in, typename S::scalar* out, size_t n, const typename S::scalar* m, typename S::scalar* box) {
+    using T = typename S::scalar;
+    constexpr size_t step = S::lanes / 2;
+    auto a = splat_pair<S>(m[0], m[3]);
+    auto b = splat_pair<S>(m[1], m[2]);
+    auto o = splat_pair<S>(m[4], m[5]);
+    auto lo = splat_pair<S>(box[0], box[1]);
+    auto hi = splat_pair<S>(box[2], box[3]);
+
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        auto p = S::load(in + 2 * i);
+        auto r = S::add(S::add(S::mul(a, p), S::mul(b, S::swap(p))), o);
+        S::store(out + 2 * i, r);
+        lo = S::min(r, lo);
+        hi = S::max(r, hi);
+    }
+
+    alignas(64) T lo_lanes[S::lanes];
+    alignas(64) T hi_lanes[S::lanes];
+    S::store(lo_lanes, lo);
+    S::store(hi_lanes, hi);
+    for (size_t l = 0; l < S::lanes; l += 2) {
+        box[0] = lo_lanes[l] < box[0] ? lo_lanes[l] : box[0];
+        box[1] = lo_lanes[l + 1] < box[1] ? lo_lanes[l + 1] : box[1];
+        box[2] = hi_lanes[l] > box[2] ? hi_lanes[l] : box[2];
+        box[3] = hi_lanes[l + 1] > box[3] ? hi_lanes[l + 1] : box[3];
+    }
+    scalar_transform_bounded(in + 2 * i, out + 2 * i, n - i, m, box);
+}
+
+// Axis by axis over all points, points outside the shape's projection are
+// cleared. Bit 2 * j of S::outside belongs to point j of the register.
+template <typename S>
+size_t vector_points_in(
+    const typename S::scalar* vertices, size_t vn, const typename S::scalar* axes, size_t an,
+    const typename S::scalar* points, size_t pn, bool* out
+) {
+    using T = typename S::scalar;
+    constexpr size_t step = S::lanes / 2;
+
+    for (size_t i = 0; i < pn; i++) out[i] = true;
+
+    for (size_t k = 0; k < an; k++) {
+        T axis_x = axes[2 * k];
+        T axis_y = axes[2 * k + 1];
+        T min = std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::lowest();
+        vector_project<S>(vertices, vn, axis_x, axis_y, min, max);
+
+        auto axis = splat_pair<S>(axis_x, axis_y);
+        auto lo = splat_pair<S>(min, min);
+        auto hi = splat_pair<S>(max, max);
+
+        size_t i = 0;
+        for (; i + step <= pn; i += step) {
+            auto d = S::mul(axis, S::load(points + 2 * i));
+            unsigned outside = S::outside(S::add(d, S::swap(d)), lo, hi);
+            if (!outside) continue;
+            for (size_t j = 0; j < step; j++) {
+                if (outside >> (2 * j) & 1) out[i + j] = false;
+            }
+        }
+        scalar_points_in(axis_x, axis_y, min, max, points + 2 * i, pn - i, out + i);
+    }
+
+    size_t inside = 0;
+    for (size_t i = 0; i < pn; i++) inside += out[i];
+    return inside;
+}
+
+template <typename T>
+size_t scalar_points_in_shape(const T* vertices, size_t vn, const T* axes, size_t an, const T* points, size_t pn, bool* out) {
+    for (size_t i = 0; i < pn; i++) out[i] = true;
+
+    for (size_t k = 0; k < an; k++) {
+        T min = std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::lowest();
+        scalar_project(vertices, vn, axes[2 * k], axes[2 * k + 1], min, max);
+        scalar_points_in(axes[2 * k], axes[2 * k + 1], min, max, points, pn, out);
+    }
+
+    size_t inside = 0;
+    for (size_t i = 0; i < pn; i++) inside += out[i];
+    return inside;
+}
+
+template <typename T>
+constexpr kernel_table<T> scalar_table() {
+    return kernel_table<T> {
+        scalar_project<T>,
+        scalar_transform<T>,
+        scalar_transform_bounded<T>,
+        scalar_points_in_shape<T>,
+    };
+}
+
+template <typename S>
+constexpr kernel_table<typename S::scalar> vector_table() {
+    return kernel_table<typename S::scalar> {
+        vector_project<S>,
+        vector_transform<S>,
+        vector_transform_bounded<S>,
+        vector_points_in<S>,
+    };
+}
+}
+}
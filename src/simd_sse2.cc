@@ -0,0 +1,45 @@
+#include <immintrin.h>
+#include "simd_kernels.h"
+
+namespace tiny_colls::details {
+namespace {
+struct sse2_f {
+    using scalar = float;
+    using reg = __m128;
+    static constexpr size_t lanes = 4;
+
+    static reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, reg v) { _mm_storeu_ps(p, v); }
+    static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+    static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+    static reg swap(reg v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); }
+    static unsigned outside(reg d, reg lo, reg hi) {
+        return _mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(d, lo), _mm_cmpgt_ps(d, hi)));
+    }
+};
+
+struct sse2_d {
+    using scalar = double;
+    using reg = __m128d;
+    static constexpr size_t lanes = 2;
+
+    static reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm_storeu_pd(p, v); }
+    static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+    static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+    static reg swap(reg v) { return _mm_shuffle_pd(v, v, 1); }
+    static unsigned outside(reg d, reg lo, reg hi) {
+        return _mm_movemask_pd(_mm_or_pd(_mm_cmplt_pd(d, lo), _mm_cmpgt_pd(d, hi)));
+    }
+};
+}
+
+extern const kernel_table<float> sse2_kernels_f;
+extern const kernel_table<double> sse2_kernels_d;
+constinit const kernel_table<float> sse2_kernels_f = vector_table<sse2_f>();
+constinit const kernel_table<double> sse2_kernels_d = vector_table<sse2_d>();
+}
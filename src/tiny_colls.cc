@@ -1 +1,151 @@
-#include "tiny_colls.h"
\ No newline at end of file
+#include "tiny_colls/stats.h"
+#include "tiny_colls/simd.h"
+#include "simd_kernels.h"
+
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace tiny_colls {
+namespace {
+std::mutex registry_mutex;
+std::vector<details::stat_counters*> live_counters;
+stats retired;
+stats baseline;
+
+void add(stats& total, const details::stat_counters& c) {
+    total.narrowphase_calls += c.narrowphase_calls.load(std::memory_order_relaxed);
+    total.axes_tested += c.axes_tested.load(std::memory_order_relaxed);
+    total.early_outs += c.early_outs.load(std::memory_order_relaxed);
+    total.projections += c.projections.load(std::memory_order_relaxed);
+    total.transforms += c.transforms.load(std::memory_order_relaxed);
+    total.allocations += c.allocations.load(std::memory_order_relaxed);
+    total.pair_cache_hits += c.pair_cache_hits.load(std::memory_order_relaxed);
+}
+
+// Counters only grow, so a reset records the current totals and later
+// snapshots subtract them instead of writing to other threads' counters.
+stats totals() {
+    stats total = retired;
+    for (auto* c : live_counters) {
+        add(total, *c);
+    }
+    return total;
+}
+}
+
+namespace details {
+stat_counters::stat_counters() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    live_counters.push_back(this);
+}
+
+stat_counters::~stat_counters() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    add(retired, *this);
+    std::erase(live_counters, this);
+}
+}
+
+stats stats_snapshot() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    stats total = totals();
+
+    return stats {
+        total.narrowphase_calls - baseline.narrowphase_calls,
+        total.axes_tested - baseline.axes_tested,
+        total.early_outs - baseline.early_outs,
+        total.projections - baseline.projections,
+        total.transforms - baseline.transforms,
+        total.allocations - baseline.allocations,
+        total.pair_cache_hits - baseline.pair_cache_hits,
+    };
+}
+
+void reset_stats() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    baseline = totals();
+}
+}
+
+namespace tiny_colls {
+namespace details {
+constinit const kernel_table<float> scalar_kernels_f = scalar_table<float>();
+constinit const kernel_table<double> scalar_kernels_d = scalar_table<double>();
+
+#ifdef TINY_COLLS_X86_KERNELS
+extern const kernel_table<float> sse2_kernels_f;
+extern const kernel_table<double> sse2_kernels_d;
+extern const kernel_table<float> avx2_kernels_f;
+extern const kernel_table<double> avx2_kernels_d;
+extern const kernel_table<float> avx512_kernels_f;
+extern const kernel_table<double> avx512_kernels_d;
+#endif
+
+// Usable before static initialization reaches the level detection below.
+constinit std::atomic<const kernel_table<float>*> kernels_f { &scalar_kernels_f };
+constinit std::atomic<const kernel_table<double>*> kernels_d { &scalar_kernels_d };
+}
+
+namespace {
+simd_level current_level = simd_level::scalar;
+
+simd_level detect_level() {
+#ifdef TINY_COLLS_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return simd_level::avx512;
+    if (__builtin_cpu_supports("avx2")) return simd_level::avx2;
+    return simd_level::sse2;
+#else
+    return simd_level::scalar;
+#endif
+}
+
+const simd_level max_level = detect_level();
+
+simd_level startup_level() {
+    const char* env = std::getenv("TINY_COLLS_SIMD");
+    if (!env) return max_level;
+
+    const char* names[] = { "scalar", "sse2", "avx2", "avx512" };
+    for (int i = 0; i < 4; i++) {
+        if (std::strcmp(env, names[i]) == 0) return std::min(max_level, simd_level(i));
+    }
+    return max_level;
+}
+
+const bool level_selected = (set_simd_level(startup_level()), true);
+}
+
+simd_level get_simd_level() {
+    return current_level;
+}
+
+simd_level get_max_simd_level() {
+    return max_level;
+}
+
+void set_simd_level(simd_level level) {
+    if (level > max_level) {
+        throw std::invalid_argument("SIMD level is not supported by this CPU or build.");
+    }
+
+    const details::kernel_table<float>* f = &details::scalar_kernels_f;
+    const details::kernel_table<double>* d = &details::scalar_kernels_d;
+#ifdef TINY_COLLS_X86_KERNELS
+    switch (level) {
+    case simd_level::sse2: f = &details::sse2_kernels_f; d = &details::sse2_kernels_d; break;
+    case simd_level::avx2: f = &details::avx2_kernels_f; d = &details::avx2_kernels_d; break;
+    case simd_level::avx512: f = &details::avx512_kernels_f; d = &details::avx512_kernels_d; break;
+    default: break;
+    }
+#endif
+
+    details::kernels_f.store(f, std::memory_order_relaxed);
+    details::kernels_d.store(d, std::memory_order_relaxed);
+    current_level = level;
+}
+}
@@ -1,20 +1,23 @@
 #include <cassert>
+#include <cstring>
 #include <numeric>
+#include <sstream>
+#include <thread>
 #include "tiny_colls.h"
 
 using namespace tiny_colls;
 
 #define EPSILON 1e-6
 
-bool is_shape_same(const collider_f& a, const collider_f& b) {
+bool is_shape_same(const collider_f& a, const collider_f& b, float epsilon = EPSILON) {
     auto a_shape = a.get_shape();
     auto b_shape = b.get_shape();
 
     if (a_shape.size() != b_shape.size()) return false;
 
     for (int i = 0; i < a_shape.size(); i++) {
-        if (std::abs(a_shape[i].x - b_shape[i].x) > EPSILON) return false;
-        if (std::abs(a_shape[i].y - b_shape[i].y) > EPSILON) return false;
+        if (std::abs(a_shape[i].x - b_shape[i].x) > epsilon) return false;
+        if (std::abs(a_shape[i].y - b_shape[i].y) > epsilon) return false;
     }
 
     return true;
@@ -153,14 +156,897 @@ void test_from_points_garbage() {
 void test_raw_garbage() {
     assert_throws(collider_f::raw(std::vector<float>()), "Creating collider from empty vector should throw.");
     assert_throws(collider_f::raw({ 25, 32, 54 }), "Creating collider from too small vector should throw.");
-    assert_throws(collider_f::raw({ 25, 32, 54, 25, 32, 54, 25, 32, 12 }), "Creating collider from uneven vertices should throw.");
-    assert_throws(collider_f::raw({ 25, 32, 54, 25, 32, 54, std::numeric_limits<float>::infinity(), 32, 12, 23 }), "Creating collider from non finite vertices should throw.");
+    assert_throws(collider_f::raw({ 25, 32, 54, 25, 32, 54, 25, 32, 12, 7 }), "Creating collider from uneven vertices should throw.");
+    assert_throws(collider_f::raw({ 25, 32, 54, 25, 32, 54, std::numeric_limits<float>::infinity(), 32, 12, 23, 5 }), "Creating collider from non finite vertices should throw.");
 }
 
 void test_ellipse_vertex_count_low() {
     assert_throws(collider_f::set_ellipse_vertex_count(-10), "Setting vertex count too low should throw.");
 }
 
+void test_world_pairs() {
+    world_f w(16.0f);
+    auto a = w.add(collider_f::rect(10.0f, 10.0f));
+    auto b = w.add(collider_f::rect(10.0f, 10.0f).set_position(5.0f, 0.0f));
+    auto c = w.add(collider_f::rect(10.0f, 10.0f).set_position(100.0f, 0.0f));
+
+    int pairs = 0;
+    w.for_each_pair([&](collider_handle x, collider_handle y, const collision_f&) {
+        assert(((x == a && y == b) || (x == b && y == a)) && "Only overlapping colliders should pair.");
+        pairs++;
+    });
+    assert(pairs == 1 && "Pairs spanning several cells should be reported once.");
+
+    w.get(c).set_position(0.0f, 5.0f);
+    w.update();
+
+    pairs = 0;
+    w.for_each_pair([&](collider_handle, collider_handle, const collision_f&) { pairs++; });
+    assert(pairs == 3 && "Moved colliders should be re-binned on update.");
+
+    w.remove(b);
+    assert(!w.contains(b) && w.size() == 2 && "Removed handles should be stale.");
+    assert_throws(w.get(b), "Accessing a stale handle should throw.");
+
+    auto d = w.add(collider_f::circle(1.0f));
+    assert(d.index == b.index && !(d == b) && "Reused slots should get a new generation.");
+
+    w.remove(d);
+    assert_throws(w.add(collider_f()), "Adding an empty collider should throw.");
+    auto e = w.add(collider_f::circle(1.0f));
+    assert(e.index == d.index && w.size() == 3 && "A rejected add should not take a slot.");
+}
+
+void test_world_region_queries() {
+    world_f w(16.0f);
+    std::vector<collider_handle> handles;
+    for (int x = 0; x < 10; x++) {
+        for (int y = 0; y < 10; y++) {
+            handles.push_back(w.add(collider_f::rect(4.0f, 4.0f).set_position(x * 10.0f, y * 10.0f)));
+        }
+    }
+
+    auto brute = [&](auto&& hit) {
+        size_t n = 0;
+        for (size_t i = 0; i < handles.size(); i++) n += hit(i % 10 * 10.0f, i / 10 * 10.0f);
+        return n;
+    };
+    std::array<collider_handle, 128> out;
+    std::array<collision_f, 128> colls;
+
+    for (AABB_f box : { AABB_f { 25, 5, 5, 33 }, AABB_f { 1000, -1000, -1000, 1000 }, AABB_f { 5, 3, 3, 5 } }) {
+        size_t expected = brute([&](float x, float y) {
+            return x + 2 >= box.left && x - 2 <= box.right && y + 2 >= box.bottom && y - 2 <= box.top;
+        });
+        assert(w.query_aabb(box, out, colls) == expected && "Box query should find every overlapping collider once.");
+    }
+
+    size_t expected = brute([](float x, float y) {
+        float dx = std::max(std::abs(x - 42.0f) - 2, 0.0f);
+        float dy = std::max(std::abs(y - 47.0f) - 2, 0.0f);
+        return dx * dx + dy * dy <= 15.0f * 15.0f;
+    });
+    size_t found = 0;
+    w.query_circle(42.0f, 47.0f, 15.0f, [&](collider_handle h, const collision_f& c) {
+        assert(w.contains(h) && (c.axis_x != 0 || c.axis_y != 0) && "Circle query should report live handles with an axis.");
+        found++;
+    });
+    assert(found == expected && "Circle query should match an exact circle.");
+
+    auto probe = collider_f::rect(30.0f, 2.0f).set_rotation(0.7f).set_position(50.0f, 50.0f);
+    expected = 0;
+    for (auto h : handles) {
+        collision_f c;
+        expected += w.get(h).is_colliding_with(probe, c);
+    }
+    assert(expected > 0 && w.query_collider(probe, std::span(out.data(), 1)) == expected && "Shape query should count hits past the buffer.");
+}
+
+void test_chunk_streamer() {
+    world_f w;
+    std::stringstream blob;
+    write_chunk<float>(blob, { collider_f::rect(1.0f, 1.0f), collider_f::rect(2.0f, 2.0f), collider_f::circle(1.0f) });
+    auto records = read_chunk<float>(blob);
+    assert(records.size() == 3 && "Binary chunks should round trip.");
+
+    // Lengths from a corrupt chunk must not be trusted for allocation.
+    std::stringstream corrupt;
+    uint32_t header[2] = { 0xFFFFFFFF, 0x7FFFFFFF };
+    corrupt.write(reinterpret_cast<const char*>(header), sizeof(header));
+    corrupt.write("\0\0\0\0", 4);
+    bool thrown = false;
+    try {
+        read_chunk<float>(corrupt);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown && "Corrupt chunk lengths should be rejected.");
+
+    chunk_streamer_f streamer(w, 100.0f, [&](chunk_coord c) {
+        if (c.x == 9) throw std::runtime_error("missing chunk");
+        return records;
+    });
+
+    streamer.load({ 0, 0 });
+    size_t inserted = 0;
+    while (streamer.pending()) {
+        size_t n = streamer.update(2);
+        assert(n <= 2 && "Splicing should respect the insertion budget.");
+        inserted += n;
+    }
+    assert(inserted == 3 && w.size() == 3 && streamer.is_resident({ 0, 0 }) && "Chunk should be spliced into the world.");
+
+    streamer.unload({ 0, 0 });
+    assert(w.size() == 0 && "Unloading should remove the chunk colliders.");
+
+    streamer.load({ 9, 0 });
+    bool threw = false;
+    while (streamer.pending()) {
+        try { streamer.update(8); }
+        catch (const std::exception&) { threw = true; }
+    }
+    assert(threw && "Loader errors should surface on update.");
+}
+
+void test_static_collider_matches_collider() {
+    auto a = static_collider_f<4>::rect(20.0f, 10.0f).set_position(3.0f, 1.0f).set_rotation(0.4f);
+    auto b = static_collider_f<8>::circle(6.0f).set_position(12.0f, 4.0f);
+    auto a_dyn = collider_f::rect(20.0f, 10.0f).set_position(3.0f, 1.0f).set_rotation(0.4f);
+    auto b_dyn = collider_f::poly(12.0f, 12.0f, 8).set_position(12.0f, 4.0f);
+
+    collision_f c_static, c_dyn, c_mixed;
+    assert(a.is_colliding_with(b, c_static) && "Static colliders should collide.");
+    assert(a_dyn.is_colliding_with(b_dyn, c_dyn) && "Dynamic colliders should collide.");
+    assert(a.is_colliding_with(b_dyn, c_mixed) && "Static and dynamic colliders should collide.");
+
+    assert(std::abs(c_static.overlap - c_dyn.overlap) < 1e-4f && "Static SAT should match dynamic SAT.");
+    assert(std::abs(c_mixed.overlap - c_dyn.overlap) < 1e-4f && "Mixed SAT should match dynamic SAT.");
+    assert(a.is_point_in(3.0f, 1.0f) && !a.is_point_in(30.0f, 1.0f) && "Static point test should work.");
+
+    auto l0 = static_collider_f<4>::rect(0.0f, 0.0f);
+    auto l1 = static_collider_f<4>::rect(0.0f, 0.0f);
+    assert(!l0.is_colliding_with(l1, c_static) && "No axes should be created.");
+}
+
+void test_constexpr_tessellation() {
+    static_assert(details::unit_polygon<float, 4>[1].y > 0.99f, "Unit shapes should be built at compile time.");
+
+    assert(is_shape_same(collider_f::ellipse<16>(10.0f, 5.0f), collider_f::ellipse(10.0f, 5.0f, 16), 1e-4f) && "Compile time and runtime ellipses should match.");
+    assert(is_shape_same(collider_f::capsule<24>(10.0f, 30.0f), collider_f::capsule(10.0f, 30.0f, 24), 1e-4f) && "Compile time and runtime capsules should match.");
+    assert(is_shape_same(collider_f::rounded_rect<16>(20.0f, 10.0f, 0.5f), collider_f::rounded_rect(20.0f, 10.0f, 0.5f, 16), 1e-4f) && "Compile time and runtime rounded rects should match.");
+    assert(collider_f::circle(4.0f, 32).get_shape().size() == 32 && "Per call vertex count should be used.");
+    assert_throws(collider_f::circle(4.0f, 4), "Per call vertex count too low should throw.");
+
+    collision_f c, c_runtime;
+    auto a = collider_f::circle<32>(5.0f);
+    auto b = collider_f::circle(5.0f, 32).set_position(8.0f, 0.0f);
+    auto a_runtime = collider_f::circle(5.0f, 32);
+    assert(a.is_colliding_with(b, c) && a_runtime.is_colliding_with(b, c_runtime) && "Both circles should collide.");
+    assert(std::abs(c.overlap - c_runtime.overlap) < 1e-4f && "Precomputed normals should give the same signed overlap.");
+    assert(std::abs(c.axis_x - c_runtime.axis_x) < 1e-4f && std::abs(c.axis_y - c_runtime.axis_y) < 1e-4f && "Precomputed normals should give the same axis.");
+
+    auto p = collider_f::poly<5>(6.0f, 6.0f).set_rotation(0.2f);
+    auto p_runtime = collider_f::poly(6.0f, 6.0f, 5).set_rotation(0.2f);
+    auto probe = collider_f::rect(3.0f, 3.0f).set_position(3.5f, 1.0f);
+    assert(p.is_colliding_with(probe, c) && p_runtime.is_colliding_with(probe, c_runtime) && "Both polygons should collide.");
+    assert(std::abs(c.overlap - c_runtime.overlap) < 1e-4f && std::abs(c.axis_x - c_runtime.axis_x) < 1e-4f && std::abs(c.axis_y - c_runtime.axis_y) < 1e-4f && "Precomputed polygon normals should match runtime ones.");
+}
+
+void test_fixed_point_collider() {
+    using collider_q = collider<q16_16>;
+    using q = q16_16;
+
+    assert(std::abs(float(sin(q(1.0f))) - std::sin(1.0f)) < 1e-3f && "Table sine should be accurate.");
+    assert(std::abs(float(sqrt(q(2.0f))) - std::sqrt(2.0f)) < 1e-4f && "Fixed sqrt should be accurate.");
+    assert(float(floor(q(-1.5f))) == -2.0f && "Fixed floor should round down.");
+
+    auto a = collider_q::rect(q(20), q(10)).set_rotation(q(0.3f));
+    auto b = collider_q::circle(q(5)).set_position(q(12), q(2));
+    auto a_f = collider_f::rect(20.0f, 10.0f).set_rotation(0.3f);
+    auto b_f = collider_f::circle(5.0f).set_position(12.0f, 2.0f);
+
+    collision<q> c;
+    collision_f c_f;
+    assert(a.is_colliding_with(b, c) && a_f.is_colliding_with(b_f, c_f) && "Fixed point colliders should collide.");
+    assert(std::abs(float(c.overlap) - c_f.overlap) < 1e-2f && "Fixed point overlap should match float.");
+
+    collision<q> c2;
+    auto a2 = collider_q::rect(q(20), q(10)).set_rotation(q(0.3f));
+    auto b2 = collider_q::circle(q(5)).set_position(q(12), q(2));
+    a2.is_colliding_with(b2, c2);
+    assert(c.overlap == c2.overlap && c.axis_x == c2.axis_x && c.axis_y == c2.axis_y && "Fixed point results should be bit identical.");
+
+    auto zero0 = collider_q::rect(q(0), q(0));
+    auto zero1 = collider_q::rect(q(0), q(0));
+    assert(!zero0.is_colliding_with(zero1, c) && "No axes should be created.");
+
+    // Edges past 181 units square beyond q16_16's range.
+    auto big0 = collider_q::rect(q(200), q(200));
+    auto big1 = collider_q::rect(q(200), q(200)).set_position(q(150), q(20));
+    assert(big0.get_axes_view().size() == 4 && "Long fixed point edges should keep their axes.");
+    assert(big0.is_colliding_with(big1, c) && c.overlap != q(0) && "Large fixed point shapes should collide.");
+    assert(std::abs(std::abs(float(c.overlap)) - 50.0f) < 1e-2f && "Large fixed point overlap should be exact.");
+    assert(collider_q::poly<8>(q(500), q(500)).get_axes_view().size() == 8 && "Large regular polygons should keep their normals.");
+
+    auto s0 = static_collider<q, 4>::rect(q(300), q(300));
+    auto s1 = static_collider<q, 4>::rect(q(300), q(300)).set_position(q(250), q(0));
+    assert(s0.is_colliding_with(s1, c) && std::abs(std::abs(float(c.overlap)) - 50.0f) < 1e-2f && "Large fixed point static shapes should collide.");
+}
+
+void test_stats() {
+    auto a = collider_f::rect(10.0f, 10.0f);
+    auto b = collider_f::rect(10.0f, 10.0f).set_position(5.0f, 0.0f);
+    auto far = collider_f::rect(10.0f, 10.0f).set_position(50.0f, 0.0f);
+    a.get_bounding_box();
+    b.get_bounding_box();
+    far.get_bounding_box();
+
+    reset_stats();
+    collision_f c;
+    a.is_colliding_with(b, c);
+    std::thread([&] { 
+        collision_f c;
+        auto a_copy = a;
+        a_copy.is_colliding_with(far, c); 
+    }).join();
+    stats s = stats_snapshot();
+
+#ifdef TINY_COLLS_STATS
+    assert(s.narrowphase_calls == 2 && "Narrowphase calls from all threads should be counted.");
+    assert(s.axes_tested == 10 && s.projections == 20 && "Every tested axis should project both shapes.");
+    assert(s.early_outs == 1 && "Separated pairs should count an early out.");
+    assert(s.transforms == 0 && s.allocations == 1 && "Only the copy should allocate.");
+
+    reset_stats();
+    assert(stats_snapshot().narrowphase_calls == 0 && "Reset should zero the snapshot.");
+#else
+    assert(s.narrowphase_calls == 0 && s.axes_tested == 0 && "Counting should compile away when disabled.");
+#endif
+}
+
+void test_contact_tracker() {
+    world_f w(16.0f);
+    contact_tracker_f tracker;
+
+    auto a = w.add(collider_f::rect(10.0f, 10.0f));
+    auto b = w.add(collider_f::rect(10.0f, 10.0f).set_position(8.0f, 0.0f));
+    auto c = w.add(collider_f::rect(10.0f, 10.0f).set_position(40.0f, 0.0f));
+
+    tracker.update(w);
+    assert(tracker.began().size() == 1 && tracker.persisted().empty() && tracker.ended().empty() && "New pair should begin.");
+
+    tracker.update(w);
+    assert(tracker.began().empty() && tracker.persisted().size() == 1 && "Touching pair should persist.");
+
+    auto* data = tracker.find(b, a);
+    assert(data && data->frames == 2 && std::abs(data->last.coll.axis_x) > 0.99f && "Pair data should be cached for warm starting.");
+
+    w.get(c).set_position(16.0f, 0.0f);
+    w.get(a).set_position(-40.0f, 0.0f);
+    w.update();
+    tracker.update(w);
+    assert(tracker.began().size() == 1 && tracker.ended().size() == 1 && "Moved pairs should begin and end.");
+    assert(tracker.ended()[0].a == a && tracker.ended()[0].b == b && "Ended pair should carry its last contact.");
+    assert(!tracker.find(a, b) && tracker.find(b, c) && "Tracked pairs should follow the world.");
+
+    w.remove(c);
+    tracker.update(w);
+    assert(tracker.ended().size() == 1 && tracker.size() == 0 && "Removed colliders should end their pairs.");
+}
+
+void test_compound_concave() {
+    // L shape, the notch is the top right 10x10 square.
+    std::vector<point_f> l_shape = { { 0, 0 }, { 20, 0 }, { 20, 10 }, { 10, 10 }, { 10, 20 }, { 0, 20 } };
+
+    auto pieces = decompose(l_shape);
+    assert(pieces.size() == 2 && "L shape should split into two convex parts.");
+
+    std::vector<point_f> reversed(l_shape.rbegin(), l_shape.rend());
+    assert(decompose(reversed).size() == 2 && "Winding should not matter.");
+    assert_throws(decompose(std::vector<point_f> { { 0, 0 }, { 1, 1 } }), "Too few vertices should throw.");
+
+    auto building = compound_f::from_polygon(l_shape);
+    assert(building.is_point_in(5.0f, 15.0f) && !building.is_point_in(15.0f, 15.0f) && "Concavity should be kept.");
+
+    collision_f c;
+    auto in_notch = compound_f::from_polygon({ { 0, 0 }, { 4, 0 }, { 4, 4 }, { 0, 4 } }).set_position(13.0f, 13.0f);
+    assert(!building.is_colliding_with(in_notch, c) && "Shapes in the notch should not collide.");
+
+    in_notch.set_position(8.0f, 13.0f);
+    assert(building.is_colliding_with(in_notch, c) && std::abs(c.overlap) > 0.0f && "Overlapping parts should collide.");
+
+    size_t part_tests = 0;
+    building.for_each_part_contact(in_notch, [&](size_t, size_t, const collision_f&) { part_tests++; });
+    assert(part_tests == 1 && "Only the overlapping part should report a contact.");
+
+    auto probe = collider_f::rect(2.0f, 2.0f).set_position(15.0f, 5.0f);
+    assert(building.is_colliding_with(probe, c) && "Compound should collide with colliders.");
+
+    building.set_position(100.0f, 0.0f).set_rotation(1.0f);
+    assert(!building.is_colliding_with(probe, c) && "Compound transform should move every part.");
+}
+
+void test_convex_hull() {
+    auto same = [](const std::vector<point_f>& a, const std::vector<point_f>& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](point_f p, point_f q) { return p.x == q.x && p.y == q.y; });
+    };
+    assert(convex_hull(std::vector<point_f>()).empty() && "An empty input should give an empty hull.");
+    assert(same(convex_hull(std::vector<point_f> { { 2, 1 }, { 2, 1 } }), { { 2, 1 } }) && "Duplicates should collapse.");
+    assert(same(convex_hull(std::vector<point_f> { { 3, 0 }, { 1, 1 } }), { { 1, 1 }, { 3, 0 } }) && "Two points should start at the leftmost.");
+    assert(same(convex_hull(std::vector<point_f> { { 0, 0 }, { 1, 3 }, { 4, 0 } }), { { 0, 0 }, { 4, 0 }, { 1, 3 } }) && "Clockwise triangles should come out counter clockwise.");
+    assert(same(convex_hull(std::vector<point_f> { { 2, 2 }, { 0, 0 }, { 1, 1 } }), { { 0, 0 }, { 2, 2 } }) && "Collinear points should reduce to their ends.");
+    assert(same(convex_hull(std::vector<point_f> { { 4, 0 }, { 0, 0 }, { 4, 0 } }), { { 0, 0 }, { 4, 0 } }) && "Duplicates should not survive in small inputs.");
+
+    std::vector<point_f> points;
+    uint32_t seed = 7;
+    for (int i = 0; i < 50000; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        float a = float(seed >> 8) / float(1 << 24) * 6.2831853f;
+        seed = seed * 1664525u + 1013904223u;
+        float r = 100.0f * float(seed >> 8) / float(1 << 24);
+        points.push_back({ r * std::cos(a), r * std::sin(a) });
+    }
+
+    hull_options_f plain;
+    plain.prefilter = false;
+    auto reference = convex_hull(points, plain);
+    auto filtered = convex_hull(points);
+
+    hull_options_f par;
+    par.parallel = true;
+    auto parallel = convex_hull(points, par);
+
+    assert(reference.size() > 3 && "Hull should have vertices.");
+    assert(filtered.size() == reference.size() && parallel.size() == reference.size() && "Prefilter and parallel sort should not change the hull.");
+    for (size_t i = 0; i < reference.size(); i++) {
+        assert(reference[i].x == filtered[i].x && reference[i].y == filtered[i].y && "Prefiltered hull should be identical.");
+        assert(reference[i].x == parallel[i].x && reference[i].y == parallel[i].y && "Parallel hull should be identical.");
+    }
+
+    hull_options_f coarse;
+    coarse.max_vertices = 12;
+    auto simple = convex_hull(points, coarse);
+    assert(simple.size() == 12 && "Simplification should reach the vertex budget.");
+
+    coarse.max_error = 1e-3f;
+    assert(convex_hull(points, coarse).size() > 12 && "Simplification should respect the error bound.");
+
+    // Every dropped vertex stays within max_error of the final outline, even
+    // after its neighbours were dropped too.
+    std::vector<point_f> ring;
+    for (int i = 0; i < 720; i++) {
+        ring.push_back({ 100.0f * std::cos(i * 6.2831853f / 720), 100.0f * std::sin(i * 6.2831853f / 720) });
+    }
+    coarse.max_vertices = 3;
+    coarse.max_error = 2.0f;
+    auto bounded = convex_hull(ring, coarse);
+    for (const auto& p : ring) {
+        float nearest = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < bounded.size(); i++) {
+            const auto& a = bounded[i];
+            const auto& b = bounded[(i + 1) % bounded.size()];
+            float dx = b.x - a.x, dy = b.y - a.y;
+            float t = std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / (dx * dx + dy * dy), 0.0f, 1.0f);
+            nearest = std::min(nearest, std::hypot(p.x - a.x - t * dx, p.y - a.y - t * dy));
+        }
+        assert(nearest <= 2.0f + 1e-3f && "Simplified hull should stay within max_error of every hull vertex.");
+    }
+
+    auto square = collider_f::from_points({ { 0, 0 }, { 10, 0 }, { 5, 5 }, { 10, 10 }, { 0, 10 }, { 2, 7 } });
+    assert(square.get_shape().size() == 4 && "Interior points should not be on the hull.");
+}
+
+void test_lod_matches_full() {
+    auto a = collider_f::ellipse<64>(10, 6);
+    a.set_lod_levels({ 8, 16, 128 });
+    assert(a.get_lod_count() == 2 && "Counts above the vertex count should be ignored.");
+
+    auto b = collider_f::circle<32>(5);
+    b.set_lod_levels({ 6 });
+
+    for (int i = 0; i < 200; i++) {
+        float angle = i * 0.0314f;
+        float dist = 10.0f + (i % 10);
+        a.set_rotation(angle * 3);
+        b.set_position(dist * std::cos(angle), dist * std::sin(angle));
+
+        collision_f full, lod;
+        bool hit = a.is_colliding_with(b, full);
+        assert(hit == a.is_colliding_with_lod(b, lod) && "Lod query should agree with the full query.");
+        if (hit) {
+            assert(full.overlap == lod.overlap && "Lod query should report the full shape MTV.");
+        }
+    }
+}
+
+void test_batch_transform() {
+    std::vector<collider_f> batch;
+    for (int i = 0; i < 50; i++) {
+        batch.push_back(collider_f::capsule<16>(3.0f, 8.0f).set_position(i * 2.0f, -i * 1.0f).set_rotation(i * 0.3f));
+    }
+    auto single = batch;
+    collider_f::update_transforms(batch, 4);
+
+    for (size_t i = 0; i < batch.size(); i++) {
+        AABB_f a = batch[i].get_bounding_box();
+        AABB_f b = single[i].get_bounding_box();
+        assert(a.left == b.left && a.right == b.right && a.top == b.top && a.bottom == b.bottom && "Batch transform should match per collider transform.");
+        assert(is_shape_same(batch[i], single[i]) && "Batch transform should match per collider transform.");
+    }
+}
+
+void test_world_update_workers() {
+    world_f serial(8.0f);
+    world_f threaded(8.0f);
+    std::vector<collider_handle> handles;
+    for (int i = 0; i < 2000; i++) {
+        auto c = collider_f::poly<6>(2.0f, 2.0f).set_position((i % 50) * 3.0f, (i / 50) * 3.0f);
+        handles.push_back(serial.add(c));
+        threaded.add(c);
+    }
+
+    for (int frame = 0; frame < 3; frame++) {
+        for (size_t i = 0; i < handles.size(); i++) {
+            float dx = (i % 7) * 0.7f * (frame + 1);
+            serial.get(handles[i]).set_position((i % 50) * 3.0f + dx, (i / 50) * 3.0f).set_rotation(frame * 0.2f);
+            threaded.get(handles[i]).set_position((i % 50) * 3.0f + dx, (i / 50) * 3.0f).set_rotation(frame * 0.2f);
+        }
+        serial.update();
+        threaded.update(4);
+
+        size_t a = 0, b = 0;
+        serial.for_each_pair([&](collider_handle, collider_handle, const collision_f&) { a++; });
+        threaded.for_each_pair([&](collider_handle, collider_handle, const collision_f&) { b++; });
+        assert(a == b && a > 0 && "Threaded update should find the same pairs as a serial one.");
+    }
+}
+
+void test_scale_and_affine() {
+    auto scaled = collider_f::rect(2.0f, 3.0f).set_scale(5.0f, 2.0f).set_rotation(0.4f).set_position(1.0f, 2.0f);
+    auto built = collider_f::rect(10.0f, 6.0f).set_rotation(0.4f).set_position(1.0f, 2.0f);
+    assert(is_shape_same(scaled, built, 1e-4f) && "Scaling should match building the larger shape.");
+    assert(is_shape_same(collider_f::raw(scaled.get_raw()), built, 1e-4f) && "Raw data should keep the scale.");
+
+    float c = std::cos(0.4f), s = std::sin(0.4f);
+    auto matrix = collider_f::rect(10.0f, 6.0f).set_transform(affine_f { c, -s, s, c, 1.0f, 2.0f });
+    assert(is_shape_same(matrix, built, 1e-4f) && "A rotation matrix should match set_rotation.");
+
+    // Sheared square against the hull of its transformed corners.
+    affine_f shear { 2.0f, 1.0f, 0.0f, 1.0f, 3.0f, 0.0f };
+    std::vector<collider_f> sheared { collider_f::rect(2.0f, 2.0f) };
+    collider_f::set_transforms(sheared, std::span<const affine_f>(&shear, 1));
+    auto hull = collider_f::from_points({ { 0, -1 }, { 4, -1 }, { 6, 1 }, { 2, 1 } });
+
+    for (int i = 0; i < 100; i++) {
+        auto probe = collider_f::circle<16>(0.5f).set_position(-1.0f + i * 0.09f, std::sin(i * 0.7f) * 1.6f);
+        collision_f a, b;
+        bool hit = sheared[0].is_colliding_with(probe, a);
+        assert(hit == hull.is_colliding_with(probe, b) && "Sheared axes should be the transformed edge normals.");
+        if (hit) {
+            assert(std::abs(a.overlap - b.overlap) < 1e-4f && "Sheared MTV should match the rebuilt shape.");
+        }
+    }
+
+    // Mirrored triangle against the hull of its mirrored corners, the MTV
+    // should agree in sign as well as length.
+    std::vector<point_f> corners { { 0, 0 }, { 4, 0 }, { 1, 3 } };
+    auto mirrored = collider_f::from_points(corners).set_scale(-1.5f, 1.0f).set_position(2.0f, 0.5f);
+    std::vector<point_f> flipped;
+    for (auto p = corners.rbegin(); p != corners.rend(); p++) flipped.push_back({ -1.5f * p->x, p->y });
+    auto expected = collider_f::from_points(flipped).set_position(2.0f, 0.5f);
+
+    for (int i = 0; i < 100; i++) {
+        auto probe = collider_f::rect(1.0f, 1.0f).set_position(-5.0f + i * 0.09f, std::sin(i * 0.7f) * 2.0f + 1.5f);
+        collision_f a, b;
+        bool hit = mirrored.is_colliding_with(probe, a);
+        assert(hit == expected.is_colliding_with(probe, b) && "Mirrored axes should be the transformed edge normals.");
+        if (hit) {
+            assert(std::abs(a.overlap - b.overlap) < 1e-4f && std::abs(a.axis_x - b.axis_x) < 1e-4f && std::abs(a.axis_y - b.axis_y) < 1e-4f && "Mirrored MTV should match the rebuilt shape.");
+        }
+    }
+
+    assert_throws(collider_f::rect(1.0f, 1.0f).set_scale(0.0f), "Zero scale should throw.");
+}
+
+void test_shape_views() {
+    auto a = collider_f::poly<6>(4.0f, 4.0f).set_position(3.0f, 1.0f).set_rotation(0.3f);
+    auto shape = a.get_shape();
+    auto raw = a.get_raw();
+
+    reset_stats();
+    auto view = a.get_shape_view();
+    assert(view.size() == shape.size() && a.get_axes_view().size() == 6 && "Views should cover every vertex and axis.");
+    size_t i = 0;
+    for (point_f p : view) {
+        assert(p.x == shape[i].x && p.y == shape[i].y && "Shape view should match get_shape.");
+        i++;
+    }
+
+    std::array<point_f, 4> small;
+    std::array<float, 32> raw_out;
+    assert(a.get_shape(small) == 6 && small[3].x == shape[3].x && "Short buffers should get a prefix and the full count.");
+    assert(a.get_raw(raw_out) == raw.size() && std::equal(raw.begin(), raw.end(), raw_out.begin()) && "Raw buffer should match get_raw.");
+#ifdef TINY_COLLS_STATS
+    assert(stats_snapshot().allocations == 0 && "Views and buffers should not allocate.");
+#endif
+
+    a.set_position(0.0f, 0.0f);
+    assert(a.get_shape_view()[0].x == a.get_shape()[0].x && "Views should follow later transforms.");
+}
+
+void test_pair_cache() {
+    world_f w(16.0f);
+    w.set_pair_cache(true);
+    auto a = w.add(collider_f::rect(10.0f, 10.0f));
+    auto b = w.add(collider_f::rect(10.0f, 10.0f).set_position(5.0f, 0.0f));
+    w.add(collider_f::rect(10.0f, 10.0f).set_position(0.0f, 8.0f));
+    w.update();
+
+    auto pass = [&] {
+        std::vector<float> overlaps;
+        w.for_each_contact([&](const contact_f& c) { overlaps.push_back(c.coll.overlap); });
+        return overlaps;
+    };
+
+    auto first = pass();
+    reset_stats();
+    assert(pass() == first && first.size() == 3 && "Cached results should match the first pass.");
+#ifdef TINY_COLLS_STATS
+    assert(stats_snapshot().pair_cache_hits == 3 && stats_snapshot().narrowphase_calls == 0 && "Idle pairs should skip the narrowphase.");
+#endif
+
+    w.get(b).set_position(6.0f, 0.0f);
+    w.update();
+    auto moved = pass();
+    assert(moved.size() == 3 && moved != first && "Moved colliders should be tested again.");
+
+    w.get(a) = collider_f::rect(10.0f, 10.0f).set_position(40.0f, 0.0f);
+    w.update();
+    assert(pass().size() == 1 && "Replaced colliders should not reuse cached results.");
+}
+
+void test_sleeping_islands() {
+    world_f w(16.0f);
+    sleep_options_f options;
+    options.frames = 3;
+    w.set_sleep_options(options);
+
+    auto ground = w.add(collider_f::rect(40.0f, 2.0f));
+    auto box = w.add(collider_f::rect(4.0f, 4.0f).set_position(0.0f, 2.5f));
+    auto mover = w.add(collider_f::rect(4.0f, 4.0f).set_position(30.0f, 2.5f));
+
+    contact_tracker_f tracker;
+    auto frame = [&] {
+        w.update();
+        tracker.update(w);
+        return tracker.began().size() + tracker.persisted().size();
+    };
+
+    for (int i = 1; i < 3; i++) {
+        w.get(mover).set_position(30.0f - i, 2.5f);
+        assert(frame() == 1 && "Resting pairs should be reported while awake.");
+    }
+    w.get(mover).set_position(27.0f, 2.5f);
+    assert(frame() == 1 && tracker.ended().empty() && "Pairs between sleepers should keep their resting contact.");
+    assert(w.is_sleeping(ground) && w.is_sleeping(box) && !w.is_sleeping(mover) && "Idle islands should fall asleep.");
+
+    w.get(mover).set_position(3.5f, 2.5f);
+    assert(frame() == 3 && "Awake colliders should still touch sleepers.");
+    frame();
+    assert(!w.is_sleeping(ground) && !w.is_sleeping(box) && "Touching a sleeper should wake its island.");
+
+    for (int i = 0; i < 5; i++) frame();
+    assert(w.is_sleeping(mover) && "The mover should join the sleeping island.");
+    w.get(box).set_rotation(0.2f);
+    frame();
+    assert(!w.is_sleeping(ground) && !w.is_sleeping(mover) && "Moving a sleeper should wake its island.");
+
+    for (int i = 0; i < 5; i++) frame();
+    w.remove(ground);
+    assert(!w.is_sleeping(box) && !w.is_sleeping(mover) && "Removing a sleeper should wake its island.");
+
+    // Islands are only found by a pair pass, updates without one keep
+    // everything awake.
+    for (int i = 0; i < 10; i++) w.update();
+    assert(!w.is_sleeping(box) && !w.is_sleeping(mover) && "Islands should not fall asleep on stale pairs.");
+    for (int i = 0; i < 5; i++) frame();
+    assert(w.is_sleeping(box) && w.is_sleeping(mover) && "Idle islands should fall asleep again.");
+}
+
+void test_lbvh_pairs() {
+    std::vector<AABB_f> boxes;
+    uint32_t seed = 7;
+    auto next = [&] { seed = seed * 1664525u + 1013904223u; return float(seed >> 8) / float(1 << 24); };
+    for (int i = 0; i < 3000; i++) {
+        float x = next() * 500.0f, y = next() * 300.0f, r = 1.0f + next() * 4.0f;
+        boxes.push_back({ y + r, y - r, x - r, x + r });
+    }
+    boxes.push_back(boxes[10]); // Equal centers must still get distinct keys
+
+    std::vector<std::pair<uint32_t, uint32_t>> expected;
+    for (uint32_t a = 0; a < boxes.size(); a++) {
+        for (uint32_t b = a + 1; b < boxes.size(); b++) {
+            if (boxes[a].right < boxes[b].left || boxes[b].right < boxes[a].left) continue;
+            if (boxes[a].top < boxes[b].bottom || boxes[b].top < boxes[a].bottom) continue;
+            expected.push_back({ a, b });
+        }
+    }
+
+    lbvh_f tree;
+    tree.build(boxes, 4);
+    assert(tree.size() == boxes.size());
+
+    std::vector<std::pair<uint32_t, uint32_t>> serial;
+    tree.for_each_overlap([&](uint32_t a, uint32_t b) { serial.push_back({ a, b }); });
+    std::sort(serial.begin(), serial.end());
+    assert(serial == expected && "Tree pairs should match brute force.");
+
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> per_worker(4);
+    tree.for_each_overlap_parallel([&](uint32_t a, uint32_t b, unsigned w) { per_worker[w].push_back({ a, b }); }, 4);
+    std::vector<std::pair<uint32_t, uint32_t>> parallel;
+    for (auto& v : per_worker) parallel.insert(parallel.end(), v.begin(), v.end());
+    std::sort(parallel.begin(), parallel.end());
+    assert(parallel == expected && "Parallel traversal should find the same pairs.");
+
+    size_t hits = 0;
+    tree.query(boxes[10], [&](uint32_t) { hits++; });
+    size_t pairs_of_10 = std::count_if(expected.begin(), expected.end(), [](auto p) { return p.first == 10 || p.second == 10; });
+    assert(hits == pairs_of_10 + 1 && "Queries should find every overlapping box.");
+
+    // Enough boxes for the radix sort to split across workers.
+    std::vector<AABB_f> many;
+    for (int i = 0; i < 40000; i++) {
+        float x = next() * 2000.0f, y = next() * 2000.0f, r = 1.0f + next() * 4.0f;
+        many.push_back({ y + r, y - r, x - r, x + r });
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> one, several;
+    tree.build(many, 1);
+    tree.for_each_overlap([&](uint32_t a, uint32_t b) { one.push_back({ a, b }); });
+    tree.build(many, 4);
+    tree.for_each_overlap([&](uint32_t a, uint32_t b) { several.push_back({ a, b }); });
+    std::sort(one.begin(), one.end());
+    std::sort(several.begin(), several.end());
+    assert(!one.empty() && one == several && "Builds on several workers should find the same pairs.");
+
+    for (uint32_t probe = 0; probe < many.size(); probe += 997) {
+        size_t found = 0, brute = 0;
+        tree.query(many[probe], [&](uint32_t) { found++; });
+        for (const auto& b : many) {
+            if (b.right < many[probe].left || many[probe].right < b.left) continue;
+            if (b.top < many[probe].bottom || many[probe].top < b.bottom) continue;
+            brute++;
+        }
+        assert(found == brute && "Queries on a parallel build should find every overlapping box.");
+    }
+}
+
+void test_overlap_solver() {
+    world_f w(16.0f);
+    auto ground = w.add(collider_f::rect(100.0f, 2.0f));
+    std::vector<collider_handle> boxes;
+    for (int i = 0; i < 5; i++) {
+        boxes.push_back(w.add(collider_f::rect(4.0f, 4.0f).set_position(i * 3.5f, 2.5f)));
+    }
+    w.update();
+
+    std::vector<contact_f> contacts;
+    w.for_each_contact([&](const contact_f& c) { contacts.push_back(c); });
+    assert(contacts.size() == 9 && "Boxes should overlap the ground and their neighbours.");
+
+    solver_options_f options;
+    options.iterations = 30;
+    overlap_solver_f solver(options);
+    solver.solve(w, contacts, [&](collider_handle h) { return h == ground ? 0.0f : 1.0f; });
+    assert(solver.color_count() >= 5 && solver.color_count() <= 7 && "Contacts sharing the ground need a color each.");
+
+    point_f g = w.get(ground).get_position();
+    assert(g.x == 0 && g.y == 0 && "Zero inverse mass bodies should not move.");
+
+    w.update();
+    float deepest = 0;
+    w.for_each_contact([&](const contact_f& c) { deepest = std::max(deepest, std::abs(c.coll.overlap)); });
+    assert(deepest < 1e-3f && "Iterating should push every pair apart.");
+
+    // Disjoint pairs all land in one color, large enough to be split.
+    world_f serial(16.0f), threaded(16.0f);
+    std::vector<collider_handle> handles;
+    for (int i = 0; i < 5000; i++) {
+        float x = (i % 100) * 20.0f, y = (i / 100) * 20.0f;
+        for (auto* pw : { &serial, &threaded }) {
+            pw->add(collider_f::rect(4.0f, 4.0f).set_position(x, y));
+            pw->add(collider_f::rect(4.0f, 4.0f).set_position(x + 3.0f, y + 0.5f).set_rotation(i * 0.01f));
+        }
+        handles.push_back(collider_handle { uint32_t(2 * i), 0 });
+        handles.push_back(collider_handle { uint32_t(2 * i + 1), 0 });
+    }
+    auto run = [](world_f& pw, unsigned workers) {
+        pw.update();
+        std::vector<contact_f> found;
+        pw.for_each_contact([&](const contact_f& c) { found.push_back(c); });
+        solver_options_f o;
+        o.workers = workers;
+        overlap_solver_f s(o);
+        s.solve(pw, found);
+        return std::pair<size_t, size_t>(found.size(), s.color_count());
+    };
+    auto one = run(serial, 1);
+    auto four = run(threaded, 4);
+    assert(one.first == 5000 && one.second == 1 && four == one && "Disjoint pairs should share a single color.");
+    for (auto h : handles) {
+        point_f a = serial.get(h).get_position(), b = threaded.get(h).get_position();
+        assert(a.x == b.x && a.y == b.y && "Splitting a color across workers should not change the result.");
+    }
+}
+
+void test_mixed_precision() {
+    const double far = 1e7;
+    auto a = collider_d::poly<7>(6.0, 4.0).set_position(far, -far).set_rotation(0.3);
+
+    for (int i = 0; i < 400; i++) {
+        auto b = collider_d::rect(3.0, 5.0)
+            .set_position(far + std::cos(i * 0.1) * (2.0 + i * 0.01), -far + std::sin(i * 0.1) * 4.0)
+            .set_rotation(i * 0.05);
+        collision_d exact, mixed;
+        bool hit = a.is_colliding_with(b, exact);
+        assert(hit == a.is_colliding_with_mixed(b, mixed) && "Mixed precision should agree on hits.");
+        if (hit) {
+            assert(std::abs(exact.overlap - mixed.overlap) < 1e-4 && "Mixed precision MTV should be close to double.");
+        }
+    }
+
+    // Touching exactly is decided in double.
+    auto left = collider_d::rect(2.0, 2.0).set_position(far, far);
+    auto right = collider_d::rect(2.0, 2.0).set_position(far + 2.0, far);
+    collision_d c;
+    left.get_bounding_box();
+    right.get_bounding_box();
+    reset_stats();
+    assert(left.is_colliding_with_mixed(right, c) && c.overlap == 0 && "Borderline pairs should fall back to double.");
+#ifdef TINY_COLLS_STATS
+    assert(stats_snapshot().narrowphase_calls == 1 && "A fallback to double should count as one call.");
+#endif
+}
+
+void test_trace_replay() {
+    std::stringstream trace;
+    world_f w;
+    trace_recorder_f rec(w, trace);
+
+    // Odd vertex counts included, raw data has to round trip them.
+    std::vector<collider_handle> handles;
+    for (int i = 0; i < 20; i++) {
+        collider_f c = i % 3 == 0 ? collider_f::poly<7>(10.0f, 10.0f)
+            : i % 3 == 1 ? collider_f::from_points({ { -5, -5 }, { 5, -5 }, { 0, 5 } })
+            : collider_f::rect(10.0f, 10.0f);
+        handles.push_back(rec.add(c.set_position(i * 8.0f, 0.0f)));
+    }
+
+    uint64_t contacts = 0;
+    uint64_t hits = 0;
+    for (int frame = 0; frame < 5; frame++) {
+        rec.set_position(handles[frame], frame * 8.0f, 5.0f);
+        rec.set_rotation(handles[frame + 1], 0.2f * frame);
+        if (frame == 3) rec.remove(handles[10]);
+        rec.update();
+        rec.for_each_contact([&](const contact_f&) { contacts++; });
+        rec.query_circle(40.0f, 0.0f, 12.0f, [&](collider_handle, const collision_f&) { hits++; });
+        rec.end_frame();
+    }
+
+    for (auto broadphase : { replay_broadphase::grid, replay_broadphase::lbvh }) {
+        std::istringstream in(trace.str());
+        replay_result r = replay_trace(in, replay_options_f { .broadphase = broadphase });
+        assert(r.frame_ms.size() == 5 && "Replay should report every recorded frame.");
+        assert(r.contacts == contacts && "Replay should find the recorded contacts.");
+        assert(r.query_hits == hits && "Replay should find the recorded query hits.");
+        assert(r.percentile(0) <= r.percentile(50) && r.percentile(50) <= r.percentile(100));
+    }
+
+    std::string data = trace.str();
+    for (size_t cut : { 3, 1 }) {
+        std::istringstream truncated(data.substr(0, data.size() - cut));
+        bool thrown = false;
+        try {
+            replay_trace<float>(truncated);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown && "Traces cut inside or between events should be rejected.");
+    }
+
+    // An add claiming far more raw data than the trace holds.
+    std::string header = data.substr(0, 12);
+    std::string huge = header + char(trace_event::add) + std::string(4, '\0') + std::string(4, '\xff');
+    std::istringstream corrupt(huge);
+    bool thrown = false;
+    try {
+        replay_trace<float>(corrupt);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown && "Corrupt raw data lengths should be rejected.");
+
+    std::istringstream wrong_type(data);
+    thrown = false;
+    try {
+        replay_trace<double>(wrong_type);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown && "Traces should only replay with the coordinate type they were recorded with.");
+}
+
+template <typename T>
+struct simd_results {
+    std::vector<point<T>> shape;
+    AABB<T> box;
+    std::vector<collision<T>> hits;
+    std::vector<uint8_t> inside;
+};
+
+template <typename T>
+simd_results<T> run_simd_kernels() {
+    simd_results<T> r;
+    auto a = collider<T>::template circle<48>(T(10)).set_position(T(0.5), T(-1.25)).set_rotation(T(0.7));
+    r.shape = a.get_shape();
+    r.box = a.get_bounding_box();
+
+    for (int i = 0; i < 30; i++) {
+        auto b = collider<T>::template poly<13>(T(6), T(9)).set_position(T(i - 15), T(i % 7)).set_rotation(T(i) * T(0.3));
+        collision<T> c {};
+        a.is_colliding_with(b, c);
+        r.hits.push_back(c);
+    }
+
+    std::vector<point<T>> points;
+    for (int i = 0; i < 101; i++) points.push_back({ T(i % 25) - T(12.5), T(i / 5) - T(9.75) });
+    std::unique_ptr<bool[]> out(new bool[points.size()]);
+    size_t n = a.is_point_in(points, std::span<bool>(out.get(), points.size()));
+    size_t count = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+        assert(out[i] == a.is_point_in(points[i].x, points[i].y) && "Batch point test should match single point tests.");
+        r.inside.push_back(out[i]);
+        count += out[i];
+    }
+    assert(n == count && "Batch point test should count the points inside.");
+    return r;
+}
+
+template <typename T>
+bool same_bits(const simd_results<T>& a, const simd_results<T>& b) {
+    auto same = [](const auto& x, const auto& y) {
+        return x.size() == y.size() && std::memcmp(x.data(), y.data(), x.size() * sizeof(x[0])) == 0;
+    };
+    return same(a.shape, b.shape) && same(a.hits, b.hits) && same(a.inside, b.inside)
+        && std::memcmp(&a.box, &b.box, sizeof(a.box)) == 0;
+}
+
+void test_simd_levels() {
+    simd_level startup = get_simd_level();
+    assert(startup <= get_max_simd_level());
+
+    set_simd_level(simd_level::scalar);
+    auto base_f = run_simd_kernels<float>();
+    auto base_d = run_simd_kernels<double>();
+
+    for (int level = 1; level <= int(get_max_simd_level()); level++) {
+        set_simd_level(simd_level(level));
+        assert(same_bits(base_f, run_simd_kernels<float>()) && "Every SIMD level should match scalar float bit for bit.");
+        assert(same_bits(base_d, run_simd_kernels<double>()) && "Every SIMD level should match scalar double bit for bit.");
+    }
+
+    if (get_max_simd_level() < simd_level::avx512) {
+        bool thrown = false;
+        try {
+            set_simd_level(simd_level::avx512);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown && "Unsupported SIMD levels should be rejected.");
+    }
+    set_simd_level(startup);
+}
+
 int main() {
     test_empty_collider();
     test_raw_save_and_load();
@@ -173,4 +1059,26 @@ int main() {
     test_from_points_garbage();
     test_raw_garbage();
     test_ellipse_vertex_count_low();
+    test_world_pairs();
+    test_world_region_queries();
+    test_chunk_streamer();
+    test_static_collider_matches_collider();
+    test_constexpr_tessellation();
+    test_fixed_point_collider();
+    test_stats();
+    test_contact_tracker();
+    test_compound_concave();
+    test_convex_hull();
+    test_lod_matches_full();
+    test_batch_transform();
+    test_world_update_workers();
+    test_scale_and_affine();
+    test_shape_views();
+    test_pair_cache();
+    test_sleeping_islands();
+    test_lbvh_pairs();
+    test_overlap_solver();
+    test_mixed_precision();
+    test_trace_replay();
+    test_simd_levels();
 }
\ No newline at end of file